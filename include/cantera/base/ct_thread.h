@@ -8,49 +8,144 @@
 
 #include "config.h"
 
-#ifdef THREAD_SAFE_CANTERA
-#include <boost/shared_ptr.hpp>
-#include <boost/thread/mutex.hpp>
-
-#endif
-
 namespace Cantera
 {
 
-#ifdef THREAD_SAFE_CANTERA
+//! A mutual exclusion lock.
+/*!
+ * Implemented using POSIX threads, or critical sections on Windows. Use a
+ * ScopedLock to acquire the lock.
+ */
+class mutex_t
+{
+public:
+    mutex_t();
+    ~mutex_t();
+
+    void lock();
+    void unlock();
 
-#if defined(BOOST_HAS_WINTHREADS)
-typedef unsigned int cthreadId_t;
-#elif defined(BOOST_HAS_PTHREADS)
-typedef pthread_t cthreadId_t;
-#endif
+private:
+    mutex_t(const mutex_t&);
+    mutex_t& operator=(const mutex_t&);
 
-class thread_equal
+    //! The native mutex object
+    void* m_mutex;
+};
+
+//! Holds the lock on a mutex_t for as long as the ScopedLock object exists
+class ScopedLock
 {
 public:
-    bool operator()(cthreadId_t L, cthreadId_t R) {
-#if defined(BOOST_HAS_WINTHREADS)
-        return L == R;
-#elif defined(BOOST_HAS_PTHREADS)
-        return pthread_equal(L, R);
-#endif
+    explicit ScopedLock(mutex_t& m) : m_(m) {
+        m_.lock();
+    }
+    ~ScopedLock() {
+        m_.unlock();
     }
+
+private:
+    ScopedLock(const ScopedLock&);
+    ScopedLock& operator=(const ScopedLock&);
+
+    mutex_t& m_;
 };
 
-typedef boost::mutex mutex_t;
-typedef boost::mutex::scoped_lock ScopedLock;
+//! A thread of execution which calls a function.
+/*!
+ * Implemented using POSIX threads, or Windows threads. The thread starts
+ * when the object is constructed, and must be joined by calling join()
+ * before the object is destroyed.
+ */
+class thread_t
+{
+public:
+    //! Start a new thread which calls `func(arg)`
+    thread_t(void (*func)(void*), void* arg);
+
+    //! Waits for the thread to finish if join() has not been called
+    ~thread_t();
 
-#else
-typedef int mutex_t;
+    //! Wait for the thread to finish
+    void join();
 
-class ScopedLock
+private:
+    thread_t(const thread_t&);
+    thread_t& operator=(const thread_t&);
+
+    //! The native thread handle
+    void* m_thread;
+};
+
+//! A key for storing a pointer which has a separate value in each thread.
+/*!
+ * Used to implement thread_specific_ptr.
+ */
+class ThreadSpecificKey
 {
 public:
-    explicit ScopedLock(const int m) : m_(m) {}
-    int m_;
+    //! @param cleanup Function called with the value for each thread that
+    //!     exits while the value is not null. Not called on Windows.
+    explicit ThreadSpecificKey(void (*cleanup)(void*));
+    ~ThreadSpecificKey();
+
+    //! The value for the calling thread, or 0 if it has not been set
+    void* get() const;
+
+    //! Set the value for the calling thread
+    void set(void* value);
+
+private:
+    ThreadSpecificKey(const ThreadSpecificKey&);
+    ThreadSpecificKey& operator=(const ThreadSpecificKey&);
+
+    //! The native key object
+    void* m_key;
 };
 
-#endif // THREAD_SAFE_CANTERA
+//! A pointer to an object owned by the calling thread.
+/*!
+ * Each thread sees its own value of the pointer, which is initially null.
+ * The object is deleted when it is replaced by calling reset(), or when the
+ * thread exits (except on Windows, where reset() must be called before the
+ * thread exits to avoid leaking the object).
+ */
+template <class T>
+class thread_specific_ptr
+{
+public:
+    thread_specific_ptr() : m_key(&cleanup) {}
+
+    //! Deletes the object for the calling thread
+    ~thread_specific_ptr() {
+        reset();
+    }
+
+    T* get() const {
+        return static_cast<T*>(m_key.get());
+    }
+
+    T* operator->() const {
+        return get();
+    }
+
+    //! Replace the object for the calling thread with *p*, deleting the
+    //! current one.
+    void reset(T* p=0) {
+        T* current = get();
+        if (current != p) {
+            delete current;
+            m_key.set(p);
+        }
+    }
+
+private:
+    static void cleanup(void* p) {
+        delete static_cast<T*>(p);
+    }
+
+    ThreadSpecificKey m_key;
+};
 
 }
 
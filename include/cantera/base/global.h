@@ -178,6 +178,9 @@ void writelogf(const char* fmt,...);
 //! Write an end of line character to the screen and flush output
 void writelogendl();
 
+//! @copydoc Application::Messages::flushlog
+void flushlog();
+
 void writeline(char repeat, size_t count,
                bool endl_after=true, bool endl_before=false);
 
@@ -34,6 +34,12 @@ namespace Cantera
 /// See the files Cantera/python/src/pylogger.h and
 /// Cantera/matlab/cantera/private/mllogger.h for examples of
 /// deriving logger classes.
+///
+/// A single logger is shared by all threads, and its methods may be called
+/// from any of them, so implementations must be thread-safe. Cantera does not
+/// hold any lock while calling the installed logger, so calls from different
+/// threads may overlap, and a logger may acquire its own locks (e.g. the
+/// Python GIL) without risk of deadlock.
 /// @ingroup textlogs
 ///
 class Logger
@@ -27,20 +27,28 @@ class XML_Reader
 public:
     //! Sole Constructor for the XML_Reader class
     /*!
+     *  The entire contents of the stream are read into an internal buffer,
+     *  which is then parsed without further access to the stream.
+     *
      *   @param input   Reference to the istream object containing
      *                  the XML file
      */
     XML_Reader(std::istream& input);
 
-    //! Read a single character from the input stream and returns it
+    //! Read a single character from the input buffer and returns it
     /*!
-     *  All low level reads occur through this function.
-     *  The function also keeps track of the line numbers.
+     *  The function also keeps track of the line numbers. At the end of
+     *  the input, *ch* is left unchanged.
      *
      * @param ch   Character to be returned.
      */
     void getchr(char& ch);
 
+    //! True if the entire input has been read
+    bool eof() const {
+        return m_pos >= m_buf.size();
+    }
+
     //!  Searches a string for the first occurrence of a valid
     //!  quoted string.
     /*!
@@ -70,7 +78,8 @@ public:
 
     //! Reads an XML tag into a string
     /*!
-     *   This function advances the input streams pointer
+     *   This function advances the input position. Returns "EOF" if the
+     *   end of the input is reached before a complete tag is found.
      *
      *    @param attribs   map of attribute name and attribute value - output
      *    @return          Output string containing name of the XML
@@ -79,7 +88,8 @@ public:
 
     //! Return the value portion of an XML element
     /*!
-     *  This function advances the input streams pointer
+     *  This function advances the input position to the start of the next
+     *  tag.
      */
     std::string readValue();
 
@@ -87,6 +97,12 @@ protected:
     //! Input stream containing the XML file
     std::istream& m_s;
 
+    //! Contents of the input stream
+    std::string m_buf;
+
+    //! Position of the next character to be read from #m_buf
+    size_t m_pos;
+
 public:
     //! Line count
     int m_line;
@@ -20,6 +20,8 @@ public:
     {
     }
     const char* what() const throw() {
+        // This may be called from code that has released the GIL
+        PyGILState_STATE gil = PyGILState_Ensure();
         formattedMessage_ = "\n" + std::string(71, '*') + "\n";
         formattedMessage_ += "Exception raised in Python callback function:\n";
 
@@ -54,6 +56,7 @@ public:
         Py_XDECREF(value_str);
 
         formattedMessage_ += "\n" + std::string(71, '*') + "\n";
+        PyGILState_Release(gil);
         return formattedMessage_.c_str();
     }
 
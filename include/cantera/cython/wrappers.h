@@ -19,21 +19,29 @@ int get_sundials_version()
 class PythonLogger : public Cantera::Logger
 {
 public:
+    // The GIL is acquired in each of these methods, since they may be called
+    // from code that has released it (e.g. ReactorNet::advance)
     virtual void write(const std::string& s) {
+        PyGILState_STATE gil = PyGILState_Ensure();
         // 1000 bytes is the maximum size permitted by PySys_WriteStdout
         static const size_t N = 999;
         for (size_t i = 0; i < s.size(); i+=N) {
             PySys_WriteStdout("%s", s.substr(i, N).c_str());
         }
+        PyGILState_Release(gil);
     }
 
     virtual void writeendl() {
+        PyGILState_STATE gil = PyGILState_Ensure();
         PySys_WriteStdout("%s", "\n");
+        PyGILState_Release(gil);
     }
 
     virtual void error(const std::string& msg) {
         std::string err = "raise Exception('''"+msg+"''')";
+        PyGILState_STATE gil = PyGILState_Ensure();
         PyRun_SimpleString(err.c_str());
+        PyGILState_Release(gil);
     }
 };
 
@@ -100,3 +108,128 @@ TRANSPORT_1D(getThermalDiffCoeffs)
 
 TRANSPORT_2D(getMultiDiffCoeffs)
 TRANSPORT_2D(getBinaryDiffCoeffs)
+
+// Function which returns a scalar property
+#define SCALAR_FUNC(PREFIX, CLASS_NAME, FUNC_NAME) \
+    double PREFIX ## _ ## FUNC_NAME(Cantera::CLASS_NAME* object) \
+    { return object->FUNC_NAME(); }
+
+#define THERMO_0D(FUNC_NAME) SCALAR_FUNC(thermo, ThermoPhase, FUNC_NAME)
+#define TRANSPORT_0D(FUNC_NAME) SCALAR_FUNC(tran, Transport, FUNC_NAME)
+
+THERMO_0D(pressure)
+THERMO_0D(meanMolecularWeight)
+THERMO_0D(enthalpy_mole)
+THERMO_0D(intEnergy_mole)
+THERMO_0D(entropy_mole)
+THERMO_0D(gibbs_mole)
+THERMO_0D(cp_mole)
+THERMO_0D(cv_mole)
+THERMO_0D(enthalpy_mass)
+THERMO_0D(intEnergy_mass)
+THERMO_0D(entropy_mass)
+THERMO_0D(gibbs_mass)
+THERMO_0D(cp_mass)
+THERMO_0D(cv_mass)
+
+TRANSPORT_0D(viscosity)
+TRANSPORT_0D(thermalConductivity)
+
+// Evaluation of properties for a sequence of states, used by SolutionArray.
+// The states are the rows of 'states', in the format used by
+// Phase::saveState. The properties of state 'i' are stored starting at
+// 'data + i*dim'. The original state of the phase is restored afterwards.
+
+//! Saves the state of a phase, and restores it when destroyed
+class ThermoStateGuard
+{
+public:
+    explicit ThermoStateGuard(Cantera::ThermoPhase* thermo) : m_thermo(thermo) {
+        m_thermo->saveState(m_state);
+    }
+    ~ThermoStateGuard() {
+        m_thermo->restoreState(m_state);
+    }
+private:
+    Cantera::ThermoPhase* m_thermo;
+    Cantera::vector_fp m_state;
+};
+
+template<class T>
+void getArray_n(void (*method)(T*, double*), Cantera::ThermoPhase* thermo,
+                T* object, size_t n, const double* states, size_t dim,
+                double* data)
+{
+    ThermoStateGuard guard(thermo);
+    size_t lenstate = thermo->nSpecies() + 2;
+    for (size_t i = 0; i < n; i++) {
+        thermo->restoreState(lenstate, states + i*lenstate);
+        method(object, data + i*dim);
+    }
+}
+
+template<class T>
+void getScalar_n(double (*method)(T*), Cantera::ThermoPhase* thermo,
+                 T* object, size_t n, const double* states, double* data)
+{
+    ThermoStateGuard guard(thermo);
+    size_t lenstate = thermo->nSpecies() + 2;
+    for (size_t i = 0; i < n; i++) {
+        thermo->restoreState(lenstate, states + i*lenstate);
+        data[i] = method(object);
+    }
+}
+
+void thermo_getArray_n(void (*method)(Cantera::ThermoPhase*, double*),
+                       Cantera::ThermoPhase* thermo, size_t n,
+                       const double* states, size_t dim, double* data)
+{
+    getArray_n(method, thermo, thermo, n, states, dim, data);
+}
+
+void kin_getArray_n(void (*method)(Cantera::Kinetics*, double*),
+                    Cantera::ThermoPhase* thermo, Cantera::Kinetics* kin,
+                    size_t n, const double* states, size_t dim, double* data)
+{
+    getArray_n(method, thermo, kin, n, states, dim, data);
+}
+
+void tran_getArray_n(void (*method)(Cantera::Transport*, double*),
+                     Cantera::ThermoPhase* thermo, Cantera::Transport* tran,
+                     size_t n, const double* states, size_t dim, double* data)
+{
+    getArray_n(method, thermo, tran, n, states, dim, data);
+}
+
+void thermo_getScalar_n(double (*method)(Cantera::ThermoPhase*),
+                        Cantera::ThermoPhase* thermo, size_t n,
+                        const double* states, double* data)
+{
+    getScalar_n(method, thermo, thermo, n, states, data);
+}
+
+void tran_getScalar_n(double (*method)(Cantera::Transport*),
+                      Cantera::ThermoPhase* thermo, Cantera::Transport* tran,
+                      size_t n, const double* states, double* data)
+{
+    getScalar_n(method, thermo, tran, n, states, data);
+}
+
+// Set a sequence of states from the temperature, pressure and composition
+// (the rows of 'comp', which are mole fractions if 'mole' is true and mass
+// fractions otherwise), and store them as the rows of 'states'.
+void thermo_setState_TPC_n(Cantera::ThermoPhase* thermo, size_t n,
+                           const double* T, const double* P,
+                           const double* comp, bool mole, double* states)
+{
+    ThermoStateGuard guard(thermo);
+    size_t nsp = thermo->nSpecies();
+    for (size_t i = 0; i < n; i++) {
+        if (mole) {
+            thermo->setState_TPX(T[i], P[i], comp + i*nsp);
+        } else {
+            thermo->setState_TPY(T[i], P[i], comp + i*nsp);
+        }
+        thermo->saveState(nsp + 2, states + i*(nsp + 2));
+    }
+}
@@ -457,6 +457,39 @@ public:
      */
     size_t numElemConstraints() const;
 
+    //! Keep the solver state between calls to equilibrate_TP()
+    /*!
+     *  If enabled, each call to equilibrate_TP() that follows a successful
+     *  one starts from the species ordering, component basis, and phase
+     *  data left by the previous solution, instead of setting up the
+     *  problem from scratch. The component basis is only recomputed if it
+     *  is no longer optimal for the new initial mole numbers. If such a
+     *  warm-started solution fails, the problem is set up again and
+     *  resolved. This is useful when the same mixture is equilibrated
+     *  repeatedly at nearby conditions. The default is false.
+     */
+    void setReuseSolver(bool reuse) {
+        m_reuseSolver = reuse;
+    }
+
+    //! Number of calls to equilibrate_TP() that were started from the
+    //! solver state left by the previous call
+    int numWarmStarts() const {
+        return m_nWarmStarts;
+    }
+
+    //! Number of warm-started calls to equilibrate_TP() that failed and were
+    //! repeated with the problem set up from scratch
+    int numWarmStartFailures() const {
+        return m_nWarmStartFailures;
+    }
+
+    //! Number of times the component basis from the previous solution was
+    //! kept without being recomputed
+    int numBasisReuses() const {
+        return (m_vsolve.m_VCount) ? m_vsolve.m_VCount->T_Basis_Reuses : 0;
+    }
+
     // Friend functions
     friend int vcs_Cantera_to_vprob(Cantera::MultiPhase* mphase,
                                     VCSnonideal::VCS_PROB* vprob);
@@ -524,6 +557,20 @@ protected:
      * than this object or the VCS_PROB object.
      */
     VCSnonideal::VCS_SOLVE m_vsolve;
+
+    //! Reuse the solver state between calls to equilibrate_TP(). See
+    //! setReuseSolver().
+    bool m_reuseSolver;
+
+    //! True if m_vsolve holds the state of a successful solution which
+    //! can be used as the starting point for the next problem
+    bool m_solverReady;
+
+    //! Number of warm-started calls to equilibrate_TP()
+    int m_nWarmStarts;
+
+    //! Number of warm-started calls which had to be repeated from scratch
+    int m_nWarmStartFailures;
 };
 
 //! Global hook for turning on and off time printing.
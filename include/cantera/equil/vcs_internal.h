@@ -66,6 +66,10 @@ public:
     //! number of optimizations of the components basis set done
     int Basis_Opts;
 
+    //! Total number of times the components basis set from the previous
+    //! problem was kept, without being optimized again
+    int T_Basis_Reuses;
+
     //! Current number of times the initial thermo
     //! equilibrium estimator has been called
     int T_Calls_Inest;
@@ -87,7 +87,9 @@ public:
      *                 set up. We call this routine to resolve it
      *                 using the problem statement and
      *                 solution estimate contained in
-     *                 the VCS_PROB structure.
+     *                 the VCS_PROB structure. If the previous call
+     *                 converged, its component basis is kept for as
+     *                 long as it remains optimal for the new estimate.
      *            2 -> Don't solve a problem. Destroy all the private
      *                 structures.
      *
@@ -1429,6 +1431,14 @@ private:
 
     // Helper functions used internally by vcs_solve_TP
     int solve_tp_component_calc(bool& allMinorZeroedSpecies);
+
+    //! Check whether the current component basis is still optimal
+    /*!
+     *  The basis is not optimal if a noncomponent species that takes part
+     *  in the formation reaction of a component has more moles than that
+     *  component.
+     */
+    bool vcs_basisOptimal();
     void solve_tp_inner(size_t& iti, size_t& it1, bool& uptodate_minors,
                         bool& allMinorZeroedSpecies, int& forceComponentCalc,
                         int& stage, bool printDetails, char* ANOTE);
@@ -1978,6 +1988,10 @@ public:
     //! Timing and iteration counters for the vcs object
     VCS_COUNTERS* m_VCount;
 
+    //! If true, the component basis left over from the previous solution
+    //! may be used for the next problem without calling vcs_basopt() again.
+    bool m_reuseBasis;
+
     //! Debug printing lvl
     /*!
      *  Levels correspond to the following guidlines
@@ -190,6 +190,24 @@ public:
     virtual void getRevRateConstants(doublereal* krev,
                                      bool doIrreversible = false);
 
+    //! Derivatives of the species net production rates with respect to the
+    //! concentrations of the species in the surface phase.
+    /*!
+     * On return, `dwdot(k, j)` is the partial derivative of the net
+     * production rate of kinetic species `k` with respect to the
+     * concentration of species `j` of the surface phase, holding the state
+     * of all other phases fixed. The dependence of the rate constants on the
+     * surface coverages (SurfaceArrhenius coverage parameters) is included.
+     * This assumes that the activity concentrations of the surface phase
+     * are its concentrations, as is the case for SurfPhase.
+     *
+     * Units are 1/s.
+     *
+     * @param dwdot  Output matrix. Resized to (nTotalSpecies(), number of
+     *               surface phase species).
+     */
+    void getNetProductionRates_ddC(Array2D& dwdot);
+
     //! @}
     //! @name Reaction Mechanism Construction
     //! @{
@@ -719,6 +737,19 @@ protected:
      */
     std::vector<std::vector<bool> > m_rxnPhaseIsProduct;
 
+    //! Work array for getNetProductionRates_ddC(): derivatives of the net
+    //! rates of progress with respect to the species concentrations.
+    //! Size (m_ii, m_kk).
+    Array2D m_ropnet_ddC;
+
+    //! Work array for getNetProductionRates_ddC(): derivatives of the
+    //! logarithms of the rate constants with respect to the coverages.
+    //! Size (number of surface species, m_ii).
+    Array2D m_dlnk_dtheta;
+
+    //! Work vector of length m_ii used by getNetProductionRates_ddC()
+    vector_fp m_rkwork;
+
     int m_ioFlag;
 };
 }
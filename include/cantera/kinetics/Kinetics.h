@@ -12,6 +12,7 @@
 
 #include "cantera/thermo/ThermoPhase.h"
 #include "StoichManager.h"
+#include "StoichMatrix.h"
 #include "cantera/thermo/mix_defs.h"
 #include "cantera/base/global.h"
 #include "cantera/base/smart_ptr.h"
@@ -615,6 +616,30 @@ public:
      */
     virtual double productStoichCoeff(size_t k, size_t i) const;
 
+    //! Sparse matrix of reactant stoichiometric coefficients. Element (k,i)
+    //! is the stoichiometric coefficient of species k as a reactant in
+    //! reaction i.
+    const StoichMatrix& reactantStoichCoeffs() {
+        updateStoichMatrices();
+        return m_reactantMatrix;
+    }
+
+    //! Sparse matrix of product stoichiometric coefficients. Element (k,i)
+    //! is the stoichiometric coefficient of species k as a product in
+    //! reaction i.
+    const StoichMatrix& productStoichCoeffs() {
+        updateStoichMatrices();
+        return m_productMatrix;
+    }
+
+    //! Sparse matrix of net stoichiometric coefficients (products minus
+    //! reactants). Element (k,i) is the net number of molecules of species
+    //! k created by reaction i.
+    const StoichMatrix& netStoichCoeffs() {
+        updateStoichMatrices();
+        return m_netMatrix;
+    }
+
     //! Reactant order of species k in reaction i.
     /*!
      * This is the nominal order of the activity concentration in
@@ -953,6 +978,24 @@ protected:
 
     //! Stoichiometry manager for the products of irreversible reactions
     StoichManagerN m_irrevProductStoich;
+
+    //! Rebuild the sparse stoichiometric coefficient matrices from #m_rrxn
+    //! and #m_prxn if reactions have been added since they were last built.
+    void updateStoichMatrices();
+
+    //! Reactant stoichiometric coefficients, built from #m_rrxn
+    StoichMatrix m_reactantMatrix;
+
+    //! Product stoichiometric coefficients, built from #m_prxn
+    StoichMatrix m_productMatrix;
+
+    //! Net stoichiometric coefficients, #m_productMatrix - #m_reactantMatrix.
+    //! Used to compute species production rates and reaction property
+    //! changes in a single pass.
+    StoichMatrix m_netMatrix;
+
+    //! True if the stoichiometric coefficient matrices are current
+    bool m_stoichMatricesOK;
     //@}
 
     //! Number of reactions in the mechanism
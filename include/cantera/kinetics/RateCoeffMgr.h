@@ -8,6 +8,7 @@
 #define CT_RATECOEFF_MGR_H
 
 #include "RxnRates.h"
+#include "cantera/base/Array.h"
 
 namespace Cantera
 {
@@ -87,6 +88,21 @@ public:
         }
     }
 
+    /**
+     * Derivatives of the logarithms of the rate coefficients with respect to
+     * the concentration-dependent quantities passed to update_C(). Column
+     * `i` of `dlnk` receives the derivatives for reaction `i`, so `dlnk`
+     * must have one row per input quantity and one column per reaction in
+     * the mechanism; it is not zeroed here. Only available for rate types
+     * that implement getCoverageDerivatives(), e.g. SurfaceArrhenius.
+     */
+    void update_dlnk_dC(const doublereal* c, doublereal T, Array2D& dlnk) const {
+        doublereal recipT = 1.0/T;
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            m_rates[i].getCoverageDerivatives(c, recipT, dlnk.ptrColumn(m_rxn[i]));
+        }
+    }
+
     size_t nReactions() const {
         return m_rates.size();
     }
@@ -198,6 +198,32 @@ public:
         return m_E + m_ecov;
     }
 
+    //! Derivatives of the logarithm of the rate constant with respect to the
+    //! surface coverages.
+    /*!
+     * The contribution of each coverage dependency is added to
+     * `dlnk[k]`, where `k` is the index of the species within the surface
+     * phase. Species whose coverage is below the cutoff used in update_C()
+     * contribute only through the `a` and `E` parameters.
+     *
+     * @param theta  Surface coverages
+     * @param recipT Reciprocal of the temperature [1/K]
+     * @param dlnk   Output array with length equal to the number of species
+     *               in the surface phase
+     */
+    void getCoverageDerivatives(const doublereal* theta, doublereal recipT,
+                                doublereal* dlnk) const {
+        for (size_t n = 0; n < m_ncov; n++) {
+            dlnk[m_sp[n]] += std::log(10.0)*m_ac[n] - m_ec[n]*recipT;
+        }
+        for (size_t n = 0; n < m_nmcov; n++) {
+            size_t k = m_msp[n];
+            if (theta[k] > Tiny) {
+                dlnk[k] += m_mc[n] / theta[k];
+            }
+        }
+    }
+
     //! @deprecated. To be removed after Cantera 2.2
     static bool alwaysComputeRate() {
         return true;
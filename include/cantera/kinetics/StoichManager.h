@@ -9,6 +9,7 @@
 
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/Array.h"
 
 namespace Cantera
 {
@@ -85,6 +86,11 @@ namespace Cantera
  *  - power(in, out) : out[irxn] is multiplied by
  *     (in[k0]^order0) * (in[k1]^order1) * (in[k2]^order2)
  *
+ *  - multiplyDerivatives(in, k, out) : out(irxn, k0), out(irxn, k1) and
+ *    out(irxn, k2) are incremented by the partial derivatives of
+ *    k[irxn] * in[k0] * in[k1] * in[k2] with respect to in[k0], in[k1] and
+ *    in[k2], respectively
+ *
  *  - incrementReaction(in, out) : out[irxn] is incremented by
  *    in[k0] + in[k1] + in[k2]
  *
@@ -173,6 +179,11 @@ public:
         R[m_rxn] *= S[m_ic0];
     }
 
+    void multiplyDerivatives(const doublereal* S, const doublereal* R,
+                             Array2D& D) const {
+        D(m_rxn, m_ic0) += R[m_rxn];
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0];
     }
@@ -255,6 +266,12 @@ public:
         R[m_rxn] *= S[m_ic0] * S[m_ic1];
     }
 
+    void multiplyDerivatives(const doublereal* S, const doublereal* R,
+                             Array2D& D) const {
+        D(m_rxn, m_ic0) += R[m_rxn] * S[m_ic1];
+        D(m_rxn, m_ic1) += R[m_rxn] * S[m_ic0];
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1];
     }
@@ -345,6 +362,13 @@ public:
         R[m_rxn] *= S[m_ic0] * S[m_ic1] * S[m_ic2];
     }
 
+    void multiplyDerivatives(const doublereal* S, const doublereal* R,
+                             Array2D& D) const {
+        D(m_rxn, m_ic0) += R[m_rxn] * S[m_ic1] * S[m_ic2];
+        D(m_rxn, m_ic1) += R[m_rxn] * S[m_ic0] * S[m_ic2];
+        D(m_rxn, m_ic2) += R[m_rxn] * S[m_ic0] * S[m_ic1];
+    }
+
     void incrementReaction(const doublereal* S, doublereal* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
     }
@@ -456,6 +480,25 @@ public:
         }
     }
 
+    void multiplyDerivatives(const doublereal* input, const doublereal* rate,
+                             Array2D& D) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_order[n] == 0.0) {
+                continue;
+            }
+            doublereal d = rate[m_rxn] * m_order[n];
+            if (m_order[n] != 1.0) {
+                d *= ppow(input[m_ic[n]], m_order[n] - 1.0);
+            }
+            for (size_t m = 0; m < m_n; m++) {
+                if (m != n && m_order[m] != 0.0) {
+                    d *= ppow(input[m_ic[m]], m_order[m]);
+                }
+            }
+            D(m_rxn, m_ic[n]) += d;
+        }
+    }
+
     void incrementSpecies(const doublereal* input,
                           doublereal* output) const {
         doublereal x = input[m_rxn];
@@ -580,6 +623,16 @@ inline static void _multiply(InputIter begin, InputIter end,
     }
 }
 
+template<class InputIter, class Vec1, class Vec2>
+inline static void _multiplyDerivatives(InputIter begin, InputIter end,
+                                        const Vec1& input, const Vec2& rate,
+                                        Array2D& output)
+{
+    for (; begin != end; ++begin) {
+        begin->multiplyDerivatives(input, rate, output);
+    }
+}
+
 template<class InputIter, class Vec1, class Vec2>
 inline static void _incrementSpecies(InputIter begin,
                                      InputIter end, const Vec1& input, Vec2& output)
@@ -812,6 +865,21 @@ public:
         _multiply(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! Derivatives of the products computed by multiply()
+    /*!
+     * Increments `output(i, k)` by the partial derivative of
+     * `rate[i] * prod_k input[k]^order_k` with respect to `input[k]`.
+     * `output` must have at least as many rows as there are reactions and
+     * as many columns as there are species.
+     */
+    void multiplyDerivatives(const doublereal* input, const doublereal* rate,
+                             Array2D& output) const {
+        _multiplyDerivatives(m_c1_list.begin(), m_c1_list.end(), input, rate, output);
+        _multiplyDerivatives(m_c2_list.begin(), m_c2_list.end(), input, rate, output);
+        _multiplyDerivatives(m_c3_list.begin(), m_c3_list.end(), input, rate, output);
+        _multiplyDerivatives(m_cn_list.begin(), m_cn_list.end(), input, rate, output);
+    }
+
     void incrementSpecies(const doublereal* input, doublereal* output) const {
         _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
         _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
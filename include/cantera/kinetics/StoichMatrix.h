@@ -0,0 +1,218 @@
+/**
+ *  @file StoichMatrix.h
+ *  Sparse matrix of stoichiometric coefficients (see \ref Stoichiometry and
+ *  class \link Cantera::StoichMatrix StoichMatrix\endlink).
+ */
+
+#ifndef CT_STOICH_MATRIX_H
+#define CT_STOICH_MATRIX_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! A sparse matrix of stoichiometric coefficients.
+/*!
+ * Element (k,i) of the matrix is the stoichiometric coefficient of species
+ * *k* in reaction *i*. The nonzero elements are stored both by rows
+ * (compressed sparse row, CSR) and by columns (compressed sparse column,
+ * CSC), so that products with the matrix and with its transpose are both
+ * computed in a single pass that reads the input vector and writes each
+ * element of the output vector only once.
+ *
+ * The storage arrays are accessible so that the matrix can be used directly
+ * in other linear algebra. For example, the nonzero elements of row *k* are
+ * `values()[j]` in columns `colIndex()[j]`, for
+ * `rowStart()[k] <= j < rowStart()[k+1]`.
+ *
+ * @ingroup Stoichiometry
+ */
+class StoichMatrix
+{
+public:
+    StoichMatrix() : m_nrows(0), m_ncols(0) {}
+
+    //! Build the matrix from a list of rows.
+    /*!
+     *  @param rows   Element `rows[k]` maps column indices to the nonzero
+     *                elements in row *k*. Elements equal to zero are not
+     *                stored.
+     *  @param ncols  Number of columns
+     */
+    void build(const std::vector<std::map<size_t, doublereal> >& rows,
+               size_t ncols) {
+        m_nrows = rows.size();
+        m_ncols = ncols;
+        m_rowStart.assign(1, 0);
+        m_colIndex.clear();
+        m_values.clear();
+        std::vector<size_t> colCount(m_ncols, 0);
+        for (size_t k = 0; k < m_nrows; k++) {
+            std::map<size_t, doublereal>::const_iterator iter;
+            for (iter = rows[k].begin(); iter != rows[k].end(); ++iter) {
+                if (iter->second != 0.0) {
+                    m_colIndex.push_back(iter->first);
+                    m_values.push_back(iter->second);
+                    colCount[iter->first]++;
+                }
+            }
+            m_rowStart.push_back(m_values.size());
+        }
+
+        // Transpose into the column-ordered storage
+        m_colStart.assign(m_ncols + 1, 0);
+        for (size_t i = 0; i < m_ncols; i++) {
+            m_colStart[i+1] = m_colStart[i] + colCount[i];
+        }
+        m_rowIndex.resize(m_values.size());
+        m_colValues.resize(m_values.size());
+        std::vector<size_t> next(m_colStart.begin(), m_colStart.end() - 1);
+        for (size_t k = 0; k < m_nrows; k++) {
+            for (size_t j = m_rowStart[k]; j < m_rowStart[k+1]; j++) {
+                size_t n = next[m_colIndex[j]]++;
+                m_rowIndex[n] = k;
+                m_colValues[n] = m_values[j];
+            }
+        }
+    }
+
+    //! Number of rows (species)
+    size_t nRows() const {
+        return m_nrows;
+    }
+
+    //! Number of columns (reactions)
+    size_t nColumns() const {
+        return m_ncols;
+    }
+
+    //! Number of stored nonzero elements
+    size_t nNonzeros() const {
+        return m_values.size();
+    }
+
+    //! Value of element (k,i). Returns zero for elements that are not stored.
+    doublereal operator()(size_t k, size_t i) const {
+        std::vector<size_t>::const_iterator b = m_colIndex.begin();
+        std::vector<size_t>::const_iterator loc = std::lower_bound(
+            b + m_rowStart[k], b + m_rowStart[k+1], i);
+        if (loc != b + m_rowStart[k+1] && *loc == i) {
+            return m_values[loc - b];
+        }
+        return 0.0;
+    }
+
+    //! Compute \f$ y = A x \f$, where *x* has length nColumns() and *y* has
+    //! length nRows().
+    void mult(const doublereal* x, doublereal* y) const {
+        // Local copies of the storage pointers, since they could otherwise
+        // be reloaded after every write to 'y'
+        const size_t* start = DATA_PTR(m_rowStart);
+        const size_t* col = DATA_PTR(m_colIndex);
+        const doublereal* val = DATA_PTR(m_values);
+        size_t n = m_nrows;
+        for (size_t k = 0; k < n; k++) {
+            doublereal sum = 0.0;
+            for (size_t j = start[k]; j < start[k+1]; j++) {
+                sum += val[j] * x[col[j]];
+            }
+            y[k] = sum;
+        }
+    }
+
+    //! Compute \f$ y = A x_1 + B x_2 \f$, where *B* has the same shape as
+    //! this matrix.
+    void mult(const doublereal* x1, const StoichMatrix& B,
+              const doublereal* x2, doublereal* y) const {
+        const size_t* startA = DATA_PTR(m_rowStart);
+        const size_t* colA = DATA_PTR(m_colIndex);
+        const doublereal* valA = DATA_PTR(m_values);
+        const size_t* startB = DATA_PTR(B.m_rowStart);
+        const size_t* colB = DATA_PTR(B.m_colIndex);
+        const doublereal* valB = DATA_PTR(B.m_values);
+        size_t n = m_nrows;
+        for (size_t k = 0; k < n; k++) {
+            doublereal sum = 0.0;
+            for (size_t j = startA[k]; j < startA[k+1]; j++) {
+                sum += valA[j] * x1[colA[j]];
+            }
+            for (size_t j = startB[k]; j < startB[k+1]; j++) {
+                sum += valB[j] * x2[colB[j]];
+            }
+            y[k] = sum;
+        }
+    }
+
+    //! Compute \f$ y = A^T x \f$, where *x* has length nRows() and *y* has
+    //! length nColumns().
+    void multTranspose(const doublereal* x, doublereal* y) const {
+        const size_t* start = DATA_PTR(m_colStart);
+        const size_t* row = DATA_PTR(m_rowIndex);
+        const doublereal* val = DATA_PTR(m_colValues);
+        size_t n = m_ncols;
+        for (size_t i = 0; i < n; i++) {
+            doublereal sum = 0.0;
+            for (size_t j = start[i]; j < start[i+1]; j++) {
+                sum += val[j] * x[row[j]];
+            }
+            y[i] = sum;
+        }
+    }
+
+    //! @name Compressed sparse row storage
+    //! @{
+
+    //! Position in colIndex() and values() of the first element of each
+    //! row. Length nRows() + 1.
+    const std::vector<size_t>& rowStart() const {
+        return m_rowStart;
+    }
+
+    //! Column index of each element, ordered by rows
+    const std::vector<size_t>& colIndex() const {
+        return m_colIndex;
+    }
+
+    //! Value of each element, ordered by rows
+    const vector_fp& values() const {
+        return m_values;
+    }
+    //! @}
+
+    //! @name Compressed sparse column storage
+    //! @{
+
+    //! Position in rowIndex() and colValues() of the first element of each
+    //! column. Length nColumns() + 1.
+    const std::vector<size_t>& colStart() const {
+        return m_colStart;
+    }
+
+    //! Row index of each element, ordered by columns
+    const std::vector<size_t>& rowIndex() const {
+        return m_rowIndex;
+    }
+
+    //! Value of each element, ordered by columns
+    const vector_fp& colValues() const {
+        return m_colValues;
+    }
+    //! @}
+
+protected:
+    size_t m_nrows;
+    size_t m_ncols;
+
+    std::vector<size_t> m_rowStart;
+    std::vector<size_t> m_colIndex;
+    vector_fp m_values;
+
+    std::vector<size_t> m_colStart;
+    std::vector<size_t> m_rowIndex;
+    vector_fp m_colValues;
+};
+
+}
+
+#endif
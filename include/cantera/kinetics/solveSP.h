@@ -299,11 +299,19 @@ private:
 
     //! Main routine that calculates the current residual and Jacobian
     /*!
+     *  When only surface species are unknowns, and the production rates of
+     *  each surface phase do not depend on the concentrations of the other
+     *  surface phases, the Jacobian is formed from the analytic derivatives
+     *  provided by InterfaceKinetics::getNetProductionRates_ddC().
+     *  Otherwise, or if #m_numericalJacobian is set, it is formed by finite
+     *  differences of fun_eval().
+     *
      *  @param jac     Jacobian to be evaluated.
      *  @param resid   output Vector of residuals, length = m_neq
      *  @param CSolnSP  Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq. These are tweaked in order
-     *                  to derive the columns of the jacobian.
+     *                  to derive the columns of the jacobian when it is
+     *                  evaluated numerically.
      *  @param CSolnSPOld Old Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq
      *  @param do_time Calculate a time dependent residual
@@ -519,8 +527,23 @@ private:
     //! Newton's method.
     SquareMatrix m_Jac;
 
+    //! Derivatives of the net production rates of one InterfaceKinetics
+    //! object with respect to its surface species concentrations
+    Array2D m_dwdot_dC;
+
+    //! True if an InterfaceKinetics object contains more than one of the
+    //! surface phases being solved for. The Jacobian then has off-diagonal
+    //! blocks which are not given by
+    //! InterfaceKinetics::getNetProductionRates_ddC(), so it is evaluated by
+    //! finite differences.
+    bool m_coupledSurfPhases;
+
 public:
     int m_ioflag;
+
+    //! If true, evaluate the Jacobian by finite differences instead of
+    //! using the analytic surface kinetics derivatives. Default: false.
+    bool m_numericalJacobian;
 };
 }
 #endif
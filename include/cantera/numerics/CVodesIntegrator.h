@@ -50,15 +50,15 @@ public:
     virtual void reinitialize(double t0, FuncEval& func);
     virtual void integrate(double tout);
     virtual doublereal step(double tout);
+    virtual void getDenseOutput(double t, int k, double* dky);
+    virtual double internalTime();
     virtual double& solution(size_t k);
     virtual double* solution();
     virtual int nEquations() const {
         return m_neq;
     }
     virtual int nEvals() const;
-    virtual void setMaxOrder(int n) {
-        m_maxord = n;
-    }
+    virtual void setMaxOrder(int n);
     virtual void setMethod(MethodType t);
     virtual void setIterator(IterType t);
     virtual void setMaxStepSize(double hmax);
@@ -68,6 +68,7 @@ public:
     virtual void setBandwidth(int N_Upper, int N_Lower) {
         m_mupper = N_Upper;
         m_mlower = N_Lower;
+        m_recreate = true;
     }
     virtual int nSensParams() {
         return m_np;
@@ -88,9 +89,19 @@ protected:
     //! during integrator initialization or reinitialization.
     void applyOptions();
 
+    //! Attach the linear solver specified by setProblemType() to the CVODES
+    //! solver. Called when the CVODES memory is created.
+    void setLinearSolver();
+
+    //! Pass the current tolerances to the CVODES solver.
+    void applyTolerances();
+
 private:
     void sensInit(double t0, FuncEval& func);
 
+    //! Set the initial values of the sensitivities to zero
+    void resetSensitivities();
+
     size_t m_neq;
     void* m_cvode_mem;
     double m_t0;
@@ -117,6 +128,15 @@ private:
     //! for at the current integrator time.
     bool m_sens_ok;
 
+    //! Indicates whether the right-hand sides of the sensitivity equations
+    //! are evaluated by FuncEval::evalSensitivities() instead of by CVODES.
+    bool m_sensEquations;
+
+    //! Indicates that the method, iteration type, linear solver or maximum
+    //! order have been changed in a way that CVODES cannot apply to existing
+    //! memory, so initialize() has to create it again instead of reusing it.
+    bool m_recreate;
+
 };
 
 }    // namespace
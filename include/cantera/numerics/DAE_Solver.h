@@ -17,6 +17,8 @@ namespace Cantera
 #define DAE_DEVEL
 #ifdef DAE_DEVEL
 
+class SparseJacobian;
+
 class Jacobian
 {
 public:
@@ -28,6 +30,9 @@ public:
     virtual bool isBanded() {
         return false;
     }
+    virtual bool isSparse() {
+        return false;
+    }
     virtual int lowerBandWidth() {
         return 0;
     }
@@ -115,6 +120,19 @@ public:
     virtual void setBandedLinearSolver(int m_upper, int m_lower) {
         warn("setBandedLinearSolver");
     }
+
+    //! Set up the problem to use an iterative linear solver, preconditioned
+    //! by an incomplete factorization of a sparse Jacobian.
+    /*!
+     *  @param jac        Matrix with the nonzero pattern of the Jacobian.
+     *                    It is used as storage by the solver, and must
+     *                    remain valid for as long as the solver is used.
+     *  @param maxKrylov  Maximum dimension of the Krylov subspace. If zero,
+     *                    the solver's default is used.
+     */
+    virtual void setSparseLinearSolver(SparseJacobian& jac, int maxKrylov = 0) {
+        warn("setSparseLinearSolver");
+    }
     virtual void setMaxStepSize(doublereal dtmax) {
         warn("setMaxStepSize");
     }
@@ -33,6 +33,7 @@ const int PowFuncType = 106;
 const int ConstFuncType = 110;
 
 class TimesConstant1;
+class CompiledFunc1;
 
 /**
  * Base class for 'functor' classes that evaluate a function of
@@ -85,9 +86,18 @@ public:
 
     virtual std::string write(const std::string& arg) const;
 
+    //! Append the instructions that evaluate this function to *code*.
+    /*!
+     *  The argument of the function is on the top of the stack of *code*,
+     *  and is replaced by the value of the function. The default
+     *  implementation calls eval() for this function.
+     */
+    virtual void compile(CompiledFunc1& code) const;
 
     //! accessor function for the stored constant
-    doublereal c() const;
+    doublereal c() const {
+        return m_c;
+    }
 
     //! Function to set the stored constant
     void setC(doublereal c);
@@ -120,6 +130,97 @@ protected:
 };
 
 
+//! A Func1 expression tree, flattened into a sequence of instructions for a
+//! stack machine.
+/*!
+ *  Evaluating a function built from Sum1, Product1, Composite1, etc. requires
+ *  a virtual call for each node of the tree. A CompiledFunc1 evaluates the
+ *  same operations, in the same order, in a single loop without recursion or
+ *  memory allocation, so that the result is identical to Func1::eval().
+ *  Functions which are not part of the tree algebra (e.g. Poly1 or functions
+ *  defined in Python) are evaluated by calling their eval() method.
+ *
+ *  The instructions refer to the nodes of the original tree, which must
+ *  remain valid for as long as the compiled function is used. The constants
+ *  of the nodes are read when the function is evaluated, so changes made
+ *  with Func1::setC() take effect immediately. Changes to the structure of
+ *  the tree require it to be compiled again.
+ */
+class CompiledFunc1
+{
+public:
+    //! Instruction codes for the stack machine. Unary operations replace the
+    //! value on the top of the stack; binary operations replace the top two
+    //! values (*a* below *b*) with the result.
+    enum OpCode {
+        Call, //!< f(x), using Func1::eval()
+        Dup, //!< push a copy of the top value
+        Swap, //!< exchange the top two values
+        Add, //!< a + b
+        Sub, //!< a - b
+        Mul, //!< a * b
+        Div, //!< a / b
+        AddConst, //!< x + c, where c is the constant of the node
+        MulConst, //!< x * c
+        Const, //!< c
+        Sin, //!< sin(c x)
+        Cos, //!< cos(c x)
+        Exp, //!< exp(c x)
+        Pow, //!< x^c
+        Periodic //!< x reduced to the interval [0, c)
+    };
+
+    //! Maximum stack depth. Functions needing a deeper stack are evaluated
+    //! with Func1::eval().
+    static const size_t MaxDepth = 32;
+
+    CompiledFunc1() : m_depth(0), m_maxDepth(0) {}
+
+    explicit CompiledFunc1(const Func1& f) : m_depth(0), m_maxDepth(0) {
+        compile(f);
+    }
+
+    //! Replace the instructions with those for evaluating *f*
+    void compile(const Func1& f);
+
+    //! Remove all instructions
+    void clear();
+
+    //! True if no function has been compiled
+    bool empty() const {
+        return m_code.empty();
+    }
+
+    //! Number of instructions
+    size_t size() const {
+        return m_code.size();
+    }
+
+    //! Evaluate the compiled function
+    doublereal eval(doublereal t) const;
+
+    //! Append an instruction for the node *f*. Called by Func1::compile().
+    void addInstruction(OpCode op, const Func1* f=0);
+
+    //! Append the instructions for the binary operation *op* applied to
+    //! *f1(x)* and *f2(x)*. Called by Func1::compile().
+    void addBinary(const Func1& f1, const Func1& f2, OpCode op);
+
+protected:
+    struct Instruction {
+        OpCode op;
+        const Func1* func; //!< node which emitted the instruction
+    };
+
+    std::vector<Instruction> m_code;
+
+    //! Stack depth after the last instruction
+    size_t m_depth;
+
+    //! Maximum stack depth reached by the instructions
+    size_t m_maxDepth;
+};
+
 Func1& newSumFunction(Func1& f1, Func1& f2);
 Func1& newDiffFunction(Func1& f1, Func1& f2);
 Func1& newProdFunction(Func1& f1, Func1& f2);
@@ -168,6 +269,10 @@ public:
         return sin(m_c*t);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Sin, this);
+    }
+
     virtual Func1& derivative() const;
 };
 
@@ -203,6 +308,9 @@ public:
     virtual doublereal eval(doublereal t) const {
         return cos(m_c * t);
     }
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Cos, this);
+    }
     virtual Func1& derivative() const;
 
 protected:
@@ -237,6 +345,9 @@ public:
     virtual doublereal eval(doublereal t) const {
         return exp(m_c*t);
     }
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Exp, this);
+    }
 
     virtual Func1& derivative() const;
 
@@ -273,6 +384,9 @@ public:
     virtual doublereal eval(doublereal t) const {
         return pow(t, m_c);
     }
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Pow, this);
+    }
     virtual Func1& derivative() const;
 
 protected:
@@ -309,6 +423,9 @@ public:
     virtual doublereal eval(doublereal t) const {
         return m_c;
     }
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Const, this);
+    }
     virtual Func1& duplicate() const {
         return *(new Const1(m_c));
     }
@@ -366,6 +483,10 @@ public:
         return m_f1->eval(t) + m_f2->eval(t);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addBinary(*m_f1, *m_f2, CompiledFunc1::Add);
+    }
+
     virtual Func1& duplicate() const {
         Func1& f1d = m_f1->duplicate();
         Func1& f2d = m_f2->duplicate();
@@ -429,6 +550,10 @@ public:
         return m_f1->eval(t) - m_f2->eval(t);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addBinary(*m_f1, *m_f2, CompiledFunc1::Sub);
+    }
+
     virtual Func1& duplicate() const {
         Func1& f1d = m_f1->duplicate();
         Func1& f2d = m_f2->duplicate();
@@ -499,6 +624,10 @@ public:
         return m_f1->eval(t) * m_f2->eval(t);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addBinary(*m_f1, *m_f2, CompiledFunc1::Mul);
+    }
+
     virtual Func1& derivative() const {
         Func1& a1 = newProdFunction(m_f1->duplicate(), m_f2->derivative());
         Func1& a2 = newProdFunction(m_f2->duplicate(), m_f1->derivative());
@@ -573,6 +702,11 @@ public:
         return m_f1->eval(t) * m_c;
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        m_f1->compile(code);
+        code.addInstruction(CompiledFunc1::MulConst, this);
+    }
+
     virtual Func1& derivative() const {
         Func1& f1d = m_f1->derivative();
         Func1* d = &newTimesConstFunction(f1d, m_c);
@@ -633,6 +767,10 @@ public:
     virtual doublereal eval(doublereal t) const {
         return m_f1->eval(t) + m_c;
     }
+    virtual void compile(CompiledFunc1& code) const {
+        m_f1->compile(code);
+        code.addInstruction(CompiledFunc1::AddConst, this);
+    }
     virtual Func1& derivative() const {
         return m_f1->derivative();
     }
@@ -691,6 +829,10 @@ public:
         return m_f1->eval(t) / m_f2->eval(t);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addBinary(*m_f1, *m_f2, CompiledFunc1::Div);
+    }
+
     virtual Func1& duplicate() const {
         Func1& f1d = m_f1->duplicate();
         Func1& f2d = m_f2->duplicate();
@@ -759,6 +901,11 @@ public:
         return m_f1->eval(m_f2->eval(t));
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        m_f2->compile(code);
+        m_f1->compile(code);
+    }
+
     virtual Func1& duplicate() const {
         Func1& f1d = m_f1->duplicate();
         Func1& f2d = m_f2->duplicate();
@@ -1057,6 +1204,11 @@ public:
         return m_func->eval(time);
     }
 
+    virtual void compile(CompiledFunc1& code) const {
+        code.addInstruction(CompiledFunc1::Periodic, this);
+        m_func->compile(code);
+    }
+
 protected:
     Func1* m_func;
 
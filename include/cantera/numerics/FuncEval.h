@@ -8,6 +8,7 @@
 #define CT_FUNCEVAL_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -48,6 +49,55 @@ public:
     virtual size_t nparams() {
         return 0;
     }
+
+    //! Returns `true` if evalSensitivities() is implemented. Otherwise, the
+    //! integrator approximates the right-hand sides of the sensitivity
+    //! equations by finite differences of eval(), which requires evaluating
+    //! the right-hand side function once for each parameter.
+    virtual bool hasSensitivityEquations() {
+        return false;
+    }
+
+    /**
+     * Evaluate the right-hand sides of the forward sensitivity equations,
+     * \f[
+     *  \dot{\vec{s}}_i = \frac{\partial \vec{F}}{\partial \vec{y}} \vec{s}_i
+     *      + \frac{\partial \vec{F}}{\partial p_i},
+     * \f]
+     * for each parameter \f$ p_i \f$ at its nominal value. Called by the
+     * integrator if hasSensitivityEquations() returns `true`.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot rate of change of solution vector, length neq()
+     * @param[in] s sensitivities, where `s[i]` is the vector of length neq()
+     *     for parameter *i*, for *i* from 0 to nparams()-1.
+     * @param[out] sdot rates of change of the sensitivities
+     */
+    virtual void evalSensitivities(double t, double* y, double* ydot,
+                                   double** s, double** sdot) {
+        throw NotImplementedError("FuncEval::evalSensitivities");
+    }
+
+    //! Returns `true` if evalJacobian() is implemented. Otherwise,
+    //! integrators which need the Jacobian compute it by finite differences.
+    virtual bool hasJacobian() {
+        return false;
+    }
+
+    /**
+     * Evaluate the Jacobian matrix \f$ \partial \vec{F} / \partial \vec{y}
+     * \f$. Called by integrators which use the Jacobian if hasJacobian()
+     * returns `true`.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot rate of change of solution vector, length neq()
+     * @param[out] jac Jacobian matrix, stored in column-major order with
+     *     leading dimension neq(), so that `jac[i + j*neq()]` is the
+     *     derivative of `ydot[i]` with respect to `y[j]`.
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* jac) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
 };
 
 }
@@ -68,6 +68,20 @@ public:
      */
     virtual void setBandedLinearSolver(int m_upper, int m_lower);
 
+    //! Set up the problem to use the GMRES iterative linear solver,
+    //! preconditioned by the incomplete LU factorization of a sparse Jacobian.
+    /*!
+     *  The Jacobian is computed by evalJacobianSparse() if an analytical
+     *  Jacobian is requested with setJacobianType(), and by finite
+     *  differences otherwise, using one residual evaluation per column
+     *  color of *jac*.
+     *
+     *  @param jac        Matrix with the nonzero pattern of the Jacobian
+     *  @param maxKrylov  Maximum dimension of the Krylov subspace. If zero,
+     *                    the IDA default of 5 is used.
+     */
+    virtual void setSparseLinearSolver(SparseJacobian& jac, int maxKrylov = 0);
+
     virtual void setMaxOrder(int n);
 
     //! Set the maximum number of time steps
@@ -223,6 +237,26 @@ public:
         return m_ida_mem;
     }
 
+    //! Compute and factor the preconditioner used by the sparse linear
+    //! solver. Called by IDA.
+    /*!
+     *  @param t     Current time
+     *  @param y     Current solution vector
+     *  @param ydot  Current derivative of the solution vector
+     *  @param r     Residual at *t*, *y*, and *ydot*
+     *  @param cj    Coefficient of the derivative terms in the Jacobian
+     *  @param tmp1  Work vector of length neq
+     *  @param tmp2  Work vector of length neq
+     *  @return 0 if successful, a positive value if the factorization
+     *      failed, or a negative value if the residual evaluation failed.
+     */
+    int setupPreconditioner(doublereal t, N_Vector y, N_Vector ydot,
+                            N_Vector r, doublereal cj,
+                            N_Vector tmp1, N_Vector tmp2);
+
+    //! Solve the preconditioner system *P z = r*. Called by IDA.
+    int solvePreconditioner(N_Vector r, N_Vector z);
+
 protected:
     //! Pointer to the IDA memory for the problem
     void* m_ida_mem;
@@ -238,6 +272,13 @@ protected:
     N_Vector m_id;
     N_Vector m_constraints;
     N_Vector m_abstol;
+
+    //! Type of the linear solver
+    /*!
+     *  0 or 1 dense direct solver
+     *  2 banded direct solver
+     *  3 GMRES iterative solver, preconditioned by #m_sparseJac
+     */
     int m_type;
 
     int m_itol;
@@ -303,6 +344,16 @@ protected:
     ResidData* m_fdata;
     int m_mupper;
     int m_mlower;
+
+    //! Sparse Jacobian used as the preconditioner when #m_type is 3. Not
+    //! owned by this object.
+    SparseJacobian* m_sparseJac;
+
+    //! Maximum dimension of the Krylov subspace for the GMRES solver
+    int m_maxKrylov;
+
+    //! Perturbations used to compute the sparse Jacobian
+    vector_fp m_dy;
 };
 
 }
@@ -132,6 +132,27 @@ public:
         return 0.0;
     }
 
+    //! Evaluate the interpolating polynomial of the most recent internal step.
+    /*!
+     * Returns the *k*-th derivative of the solution with respect to time at
+     * time *t*, without advancing the integrator. This is only valid for
+     * values of *t* within the last internal step taken by the integrator,
+     * and for *k* not greater than the order of the method used on that step.
+     * @param t     Time at which to evaluate the interpolant
+     * @param k     Order of the derivative; 0 gives the solution itself
+     * @param dky   Output array of length nEquations()
+     */
+    virtual void getDenseOutput(double t, int k, double* dky) {
+        warn("getDenseOutput");
+    }
+
+    //! The time reached by the last internal step of the integrator, which
+    //! may be later than the output time of integrate().
+    virtual double internalTime() {
+        warn("internalTime");
+        return 0.0;
+    }
+
     /** The current value of the solution of equation k. */
     virtual doublereal& solution(size_t k) {
         warn("solution");
@@ -0,0 +1,171 @@
+/**
+ *  @file OneStepIntegrator.h
+ *  Base class for one-step ODE integrators with adaptive step size control.
+ */
+
+#ifndef CT_ONESTEPINTEGRATOR_H
+#define CT_ONESTEPINTEGRATOR_H
+
+#include "cantera/numerics/Integrator.h"
+
+namespace Cantera
+{
+
+//! Base class for one-step methods with embedded error estimates.
+/*!
+ *  One-step methods (Runge-Kutta and Rosenbrock methods) need no history of
+ *  previous steps, so they can be started and restarted more cheaply than
+ *  the variable-order multistep methods of CVODES. This makes them
+ *  attractive when the integrator is restarted frequently, as in the
+ *  chemistry substeps of operator-split flow solvers.
+ *
+ *  This class implements the parts shared by these methods: the step size
+ *  control, the choice of the initial step size, the integration to an
+ *  output time and the dense output. Derived classes implement a single
+ *  attempted step in attemptStep().
+ *
+ *  The local error estimates are measured in the weighted root-mean-square
+ *  norm used by CVODES, with weights \f$ 1 / (a_i + r |y_i|) \f$. The dense
+ *  output is given by cubic Hermite interpolation between the ends of the
+ *  last step. Sensitivity analysis is not supported.
+ *
+ *  @ingroup odeGroup
+ */
+class OneStepIntegrator : public Integrator
+{
+public:
+    OneStepIntegrator();
+
+    virtual void setTolerances(double reltol, size_t n, double* abstol);
+    virtual void setTolerances(double reltol, double abstol);
+    virtual void setSensitivityTolerances(double reltol, double abstol) {}
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+    virtual void integrate(double tout);
+    virtual double step(double tout);
+
+    //! Evaluate the cubic Hermite interpolant of the last step. Derivatives
+    //! up to *k* = 3 are available.
+    virtual void getDenseOutput(double t, int k, double* dky);
+
+    virtual double internalTime() {
+        return m_tn;
+    }
+    virtual double& solution(size_t k) {
+        return m_y[k];
+    }
+    virtual double* solution() {
+        return &m_y[0];
+    }
+    virtual int nEquations() const {
+        return static_cast<int>(m_neq);
+    }
+    virtual int nEvals() const {
+        return m_nevals;
+    }
+    virtual void setMaxStepSize(double hmax) {
+        m_hmax = hmax;
+    }
+    virtual void setMinStepSize(double hmin) {
+        m_hmin = hmin;
+    }
+    //! Set the maximum number of consecutive rejected attempts of a step
+    virtual void setMaxErrTestFails(int n) {
+        m_maxErrTestFails = n;
+    }
+    //! Set the maximum number of steps taken by a single call to integrate()
+    virtual void setMaxSteps(int nmax) {
+        m_maxsteps = nmax;
+    }
+    virtual int nSensParams() {
+        return 0;
+    }
+
+    //! Number of accepted steps since the last call to initialize() or
+    //! reinitialize()
+    int nSteps() const {
+        return m_nsteps;
+    }
+
+    //! Number of rejected steps since the last call to initialize() or
+    //! reinitialize()
+    int nRejectedSteps() const {
+        return m_nrejected;
+    }
+
+protected:
+    //! Attempt a step of size *h* from the current state.
+    /*!
+     *  The step starts from #m_tn, #m_yn, where the time derivatives are
+     *  #m_fn. Implementations set #m_ynew to the solution at the end of the
+     *  step and #m_fnew to the time derivatives there.
+     *
+     *  @returns the weighted RMS norm of the local error estimate. The step
+     *      is accepted if this is not greater than one.
+     */
+    virtual double attemptStep(double h) = 0;
+
+    //! Order of the local error estimate, which determines how the step size
+    //! is adjusted.
+    virtual int errorOrder() const = 0;
+
+    //! Called after a step has been accepted, when #m_tn, #m_yn and #m_fn
+    //! have been updated.
+    virtual void stepAccepted() {}
+
+    //! Called by initialize() after the common work arrays have been
+    //! resized, to allocate the work arrays of derived classes.
+    virtual void resize() {}
+
+    //! Evaluate the right-hand side function, counting the evaluations.
+    void eval(double t, const double* y, double* ydot);
+
+    //! Compute the error weights for the step from #m_yn to #m_ynew.
+    void updateWeights();
+
+    //! Weighted RMS norm of *v*, using the weights set by updateWeights().
+    double weightedNorm(const double* v) const;
+
+    //! Take a single accepted step, which does not go past *tout*.
+    void takeStep(double tout);
+
+    //! Estimate the size of the first step. Follows Hairer, Norsett and
+    //! Wanner, Solving Ordinary Differential Equations I, Section II.4.
+    double initialStepSize(double tout);
+
+    FuncEval* m_func;
+    size_t m_neq;
+
+    double m_reltol;
+    vector_fp m_abstol; //!< absolute tolerances, length #m_neq
+    double m_abstols; //!< scalar absolute tolerance
+    bool m_scalarTol; //!< `true` if #m_abstols applies to all components
+    vector_fp m_weights; //!< error weights
+
+    double m_tn; //!< time at the end of the last step
+    vector_fp m_yn; //!< solution at #m_tn
+    vector_fp m_fn; //!< time derivatives at #m_tn
+    double m_told; //!< time at the start of the last step
+    vector_fp m_yold; //!< solution at #m_told
+    vector_fp m_fold; //!< time derivatives at #m_told
+    vector_fp m_ynew; //!< solution at the end of the attempted step
+    vector_fp m_fnew; //!< time derivatives at the end of the attempted step
+
+    double m_time; //!< output time
+    vector_fp m_y; //!< solution at #m_time
+
+    double m_h; //!< size of the next step, or 0 if not yet determined
+    double m_hmax;
+    double m_hmin;
+    int m_maxsteps;
+    int m_maxErrTestFails;
+    bool m_rejected; //!< `true` if the last attempt of a step was rejected
+
+    int m_nevals;
+    int m_nsteps;
+    int m_nrejected;
+};
+
+}
+
+#endif
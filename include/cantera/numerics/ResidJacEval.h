@@ -20,6 +20,8 @@
 namespace Cantera
 {
 
+class SparseJacobian;
+
 //! Differentiates the type of residual evaluations according to functionality
 enum ResidEval_Type_Enum {
     //! Base residual calculation for the time-stepping function
@@ -309,6 +311,30 @@ public:
                                doublereal* const* jacobianColPts,
                                doublereal* const resid);
 
+    //! Calculate an analytical sparse jacobian and the residual at the current
+    //! time and values.
+    /*!
+     *  Only called if the jacFormation method is set to analytical and a
+     *  sparse linear solver is used. Only the elements in the nonzero pattern
+     *  of *J* are set.
+     *
+     * @param t             Time                    (input)
+     * @param delta_t       The current value of the time step (input)
+     * @param cj            Coefficient of yprime used in the evaluation of the jacobian
+     * @param y             Solution vector (input, do not modify)
+     * @param ydot          Rate of change of solution vector. (input, do not modify)
+     * @param J             Sparse matrix to be calculated (output)
+     * @param resid         Value of the residual that is computed (output)
+     *
+     * @return Returns a flag to indicate that operation is successful.
+     *            1  Means a successful operation
+     *           -0 or neg value Means an unsuccessful operation
+     */
+    virtual int evalJacobianSparse(const doublereal t, const doublereal delta_t,
+                                   doublereal cj, const doublereal* const y,
+                                   const doublereal* const ydot,
+                                   SparseJacobian& J, doublereal* const resid);
+
 protected:
     //! constant value of atol
     doublereal m_atol;
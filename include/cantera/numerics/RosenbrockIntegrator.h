@@ -0,0 +1,90 @@
+/**
+ *  @file RosenbrockIntegrator.h
+ *  Header file for class RosenbrockIntegrator.
+ */
+
+#ifndef CT_ROSENBROCKINTEGRATOR_H
+#define CT_ROSENBROCKINTEGRATOR_H
+
+#include "cantera/numerics/OneStepIntegrator.h"
+#include "cantera/numerics/DenseMatrix.h"
+
+namespace Cantera
+{
+
+//! A linearly-implicit Rosenbrock integrator for stiff systems.
+/*!
+ *  Uses the four-stage, third-order RODAS3 method of Sandu et al. (Atmos.
+ *  Environ. 31:3459-3472, 1997), which is L-stable and stiffly accurate,
+ *  with an embedded second-order error estimate. Each step requires one
+ *  evaluation of the Jacobian, one LU factorization, three evaluations of
+ *  the right-hand side and four linear solves, but no Newton iterations, so
+ *  the cost of a step is fixed. The Jacobian is reused if a step is
+ *  rejected. Because the method is of low order, it is most efficient at
+ *  moderate tolerances.
+ *
+ *  The Jacobian is computed by finite differences unless the problem type
+ *  is set to `DENSE + JAC` using setProblemType(), in which case
+ *  FuncEval::evalJacobian() is used. The derivative of the right-hand side
+ *  with respect to time is always computed by finite differences.
+ *
+ *  With a finite difference Jacobian, which needs one evaluation of the
+ *  right-hand side per state variable at every step, this integrator is
+ *  slower than CVODES for large mechanisms at tight tolerances. For
+ *  constant pressure reactors with GRI-Mech 3.0 at the ReactorNet default
+ *  tolerance (rtol = 1e-9), it integrates 3 to 6 times fewer reactors per
+ *  second. It is faster when the integration is restarted often. See
+ *  ReactorNet::setIntegratorType().
+ *
+ *  @ingroup odeGroup
+ */
+class RosenbrockIntegrator : public OneStepIntegrator
+{
+public:
+    RosenbrockIntegrator();
+
+    //! Select the Jacobian: `DENSE + NOJAC` (the default) for finite
+    //! differences, or `DENSE + JAC` for FuncEval::evalJacobian().
+    virtual void setProblemType(int probtype);
+
+    virtual void initialize(double t0, FuncEval& func);
+    virtual void reinitialize(double t0, FuncEval& func);
+
+    //! Number of Jacobian evaluations since the last call to initialize() or
+    //! reinitialize()
+    int nJacobians() const {
+        return m_njac;
+    }
+
+protected:
+    virtual double attemptStep(double h);
+    virtual int errorOrder() const {
+        return 2;
+    }
+    virtual void stepAccepted() {
+        m_jacCurrent = false;
+    }
+    virtual void resize();
+
+    //! Evaluate the Jacobian and the time derivative of the right-hand side
+    //! at #m_tn, #m_yn
+    void evalJacobian(double h);
+
+    //! Solve the linear system using the LU factorization in #m_lu. The
+    //! right-hand side is replaced by the solution.
+    void solve(double* b);
+
+    bool m_analyticJac; //!< `true` to use FuncEval::evalJacobian()
+    bool m_jacCurrent; //!< `true` if #m_jac is evaluated at #m_tn, #m_yn
+    int m_njac;
+
+    vector_fp m_jac; //!< Jacobian, column-major
+    vector_fp m_dfdt; //!< partial derivative of the RHS with respect to time
+    DenseMatrix m_lu; //!< LU factorization of (1/(gamma h) I - J)
+    vector_fp m_K; //!< stage increments
+    vector_fp m_work;
+};
+
+}
+
+#endif
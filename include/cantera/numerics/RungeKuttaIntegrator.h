@@ -0,0 +1,70 @@
+/**
+ *  @file RungeKuttaIntegrator.h
+ *  Header file for class RungeKuttaIntegrator.
+ */
+
+#ifndef CT_RUNGEKUTTAINTEGRATOR_H
+#define CT_RUNGEKUTTAINTEGRATOR_H
+
+#include "cantera/numerics/OneStepIntegrator.h"
+
+namespace Cantera
+{
+
+//! An explicit Runge-Kutta integrator with stiffness detection.
+/*!
+ *  Uses the fifth-order method of Dormand and Prince with an embedded
+ *  fourth-order error estimate. The last stage of each step is evaluated at
+ *  the solution at the end of the step, so each accepted step requires six
+ *  evaluations of the right-hand side function.
+ *
+ *  Explicit methods are efficient only for problems that are not stiff, such
+ *  as reacting mixtures which are far from ignition or equilibrium. To avoid
+ *  taking a very large number of small steps on stiff problems, the
+ *  stiffness test of Hairer and Wanner (Solving Ordinary Differential
+ *  Equations I, Section IV.2) is applied after each step. It estimates the
+ *  product of the step size and the dominant eigenvalue of the Jacobian. If
+ *  this estimate is near the boundary of the stability region for
+ *  #m_maxStiffSteps accepted steps, without six consecutive steps away from
+ *  it, a CanteraError is thrown and a stiff integrator should be used
+ *  instead.
+ *
+ *  @ingroup odeGroup
+ */
+class RungeKuttaIntegrator : public OneStepIntegrator
+{
+public:
+    RungeKuttaIntegrator();
+
+    virtual void reinitialize(double t0, FuncEval& func);
+
+    //! Set the number of steps which are limited by stability rather than
+    //! accuracy after which the problem is considered to be stiff. A value of
+    //! 0 disables the stiffness test.
+    void setMaxStiffSteps(int n) {
+        m_maxStiffSteps = n;
+    }
+
+protected:
+    virtual double attemptStep(double h);
+    virtual int errorOrder() const {
+        return 4;
+    }
+    virtual void stepAccepted();
+    virtual void resize();
+
+    //! Stage derivatives. The first and last stages are #m_fn and #m_fnew.
+    vector_fp m_k2, m_k3, m_k4, m_k5, m_k6;
+    //! Solution at which #m_k6 is evaluated, used by the stiffness test
+    vector_fp m_ystiff;
+    vector_fp m_work;
+    double m_hlast; //!< size of the last attempted step
+
+    int m_maxStiffSteps;
+    int m_nstiff; //!< number of steps detected as limited by stability
+    int m_nonstiff; //!< number of consecutive steps that are not
+};
+
+}
+
+#endif
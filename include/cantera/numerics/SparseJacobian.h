@@ -0,0 +1,179 @@
+/**
+ *  @file SparseJacobian.h
+ *  Header file for class SparseJacobian
+ */
+
+#ifndef CT_SPARSEJACOBIAN_H
+#define CT_SPARSEJACOBIAN_H
+
+#include "DAE_Solver.h"
+
+namespace Cantera
+{
+
+class ResidJacEval;
+
+//! A square sparse matrix with a fixed nonzero pattern, stored in compressed
+//! sparse row (CSR) format.
+/*!
+ *  The nonzero pattern is given when the matrix is created, and is used by
+ *  IDA_Solver for the iteration matrix \f$ \partial F / \partial y + c_j
+ *  \partial F / \partial \dot{y} \f$ of a DAE system. The diagonal elements
+ *  are always included in the pattern.
+ *
+ *  The class provides what is needed to use the matrix as a preconditioner
+ *  for an iterative linear solver: an incomplete LU factorization with the
+ *  same nonzero pattern as the matrix (ILU(0)), and a coloring of the
+ *  columns so that the matrix can be computed by finite differences with
+ *  one residual evaluation per color rather than one per column.
+ */
+class SparseJacobian : public Jacobian
+{
+public:
+    //! Create a matrix with the given nonzero pattern.
+    /*!
+     *  @param n         Number of rows and columns
+     *  @param rowStart  Index in *colIndex* of the first element of each row,
+     *                   followed by the total number of elements (length n+1)
+     *  @param colIndex  Column of each element. Within each row, the columns
+     *                   need not be sorted, and duplicates are ignored.
+     */
+    SparseJacobian(size_t n, const vector_int& rowStart,
+                   const vector_int& colIndex);
+
+    virtual bool isSparse() {
+        return true;
+    }
+
+    //! Number of rows and columns
+    size_t nRows() const {
+        return m_n;
+    }
+
+    //! Number of elements in the nonzero pattern
+    size_t nNonzeros() const {
+        return m_colIndex.size();
+    }
+
+    //! Index of the first element of each row, followed by nNonzeros()
+    const vector_int& rowStart() const {
+        return m_rowStart;
+    }
+
+    //! Column of each element. The columns within each row are sorted.
+    const vector_int& colIndex() const {
+        return m_colIndex;
+    }
+
+    //! Values of the elements, in the order given by rowStart() and
+    //! colIndex()
+    vector_fp& values() {
+        return m_values;
+    }
+
+    //! Index in values() of element (*i*, *j*), or -1 if the element is not
+    //! in the nonzero pattern.
+    int index(size_t i, size_t j) const;
+
+    //! Reference to element (*i*, *j*). Throws an exception if the element
+    //! is not in the nonzero pattern.
+    doublereal& operator()(size_t i, size_t j);
+
+    //! Value of element (*i*, *j*), which is zero if the element is not in
+    //! the nonzero pattern.
+    doublereal operator()(size_t i, size_t j) const;
+
+    //! Set all of the elements to zero
+    void zero();
+
+    //! Multiply the matrix by the vector *b*, and store the result in *prod*.
+    void mult(const doublereal* b, doublereal* prod) const;
+
+    //! Number of colors used to color the columns.
+    /*!
+     *  Columns with the same color have no nonzero elements in the same row,
+     *  so that they can be perturbed at the same time when computing the
+     *  matrix by finite differences.
+     */
+    size_t nColors() const {
+        return m_ncolors;
+    }
+
+    //! Color of column *j*
+    int color(size_t j) const {
+        return m_color[j];
+    }
+
+    //! Rows of the nonzero elements in column *j*
+    const vector_int& colRows(size_t j) const {
+        return m_colRows[j];
+    }
+
+    //! Indices in values() of the nonzero elements in column *j*, in the
+    //! same order as colRows().
+    const vector_int& colElements(size_t j) const {
+        return m_colElements[j];
+    }
+
+    //! Compute the iteration matrix of a DAE system by finite differences.
+    /*!
+     *  The elements of \f$ \partial F / \partial y + c_j \partial F /
+     *  \partial \dot{y} \f$ in the nonzero pattern are computed from
+     *  one-sided differences, with *y[j]* perturbed by *dy[j]* and
+     *  *ydot[j]* by *cj dy[j]*. All of the columns with the same color are
+     *  perturbed together, so the residual is evaluated once per color.
+     *
+     *  @param func    Residual function, evaluated with
+     *                 ResidJacEval::evalResidNJ()
+     *  @param t       Time
+     *  @param delta_t Current time step
+     *  @param cj      Coefficient of the derivatives with respect to ydot
+     *  @param y       Solution vector, length nRows()
+     *  @param ydot    Time derivative of the solution vector
+     *  @param resid   Residual at *y* and *ydot*
+     *  @param dy      Perturbation of each solution component
+     *  @returns 0 if successful, or the negative value returned by
+     *      ResidJacEval::evalResidNJ() if it fails.
+     */
+    int evalFiniteDifference(ResidJacEval& func, doublereal t,
+                             doublereal delta_t, doublereal cj,
+                             const doublereal* y, const doublereal* ydot,
+                             const doublereal* resid, const doublereal* dy);
+
+    //! Compute the incomplete LU factorization of the matrix, with the same
+    //! nonzero pattern as the matrix. The matrix values are not modified.
+    //! @returns 0 if successful, or *i*+1 if the pivot in row *i* is zero.
+    int factorILU();
+
+    //! Solve the system *LU x = b* using the factors computed by
+    //! factorILU(). On return, *b* contains the solution *x*.
+    void solveILU(doublereal* b) const;
+
+protected:
+    //! Compute the columns structure and the column coloring
+    void computeColoring();
+
+    size_t m_n;
+    vector_int m_rowStart;
+    vector_int m_colIndex;
+    vector_int m_diag; //!< index of the diagonal element of each row
+    vector_fp m_values;
+    vector_fp m_lu; //!< incomplete LU factors, with the same layout as #m_values
+
+    size_t m_ncolors;
+    vector_int m_color;
+    std::vector<vector_int> m_colRows;
+    std::vector<vector_int> m_colElements;
+    vector_int m_work;
+
+    //! @name Work arrays used by evalFiniteDifference()
+    //! @{
+    vector_fp m_ywork;
+    vector_fp m_ydotwork;
+    vector_fp m_rwork;
+    //! @}
+};
+
+}
+
+#endif
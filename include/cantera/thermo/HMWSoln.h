@@ -2709,6 +2709,64 @@ private:
      */
     mutable vector_int m_CounterIJ;
 
+    //! @name Lists of active interactions
+    //! These lists are filled in by interactionLists_setup() once all of the
+    //! Pitzer parameters have been read. The activity coefficient routines
+    //! use them to skip the many interactions which are zero for any
+    //! realistic parameter set. Each list is ordered in the same way as the
+    //! dense loops over the species it replaces, so that the sums are
+    //! evaluated in the same order.
+    //! @{
+
+    //! Pairs of oppositely charged solute species (i,j), with i < j, stored
+    //! as n = m_kk*i + j, in increasing order. Only pairs with a nonzero
+    //! beta0, beta1, beta2 or Cphi parameter are included, so BMX and CMX
+    //! are zero for all other pairs.
+    std::vector<size_t> m_CationAnionPairs;
+
+    //! Pairs of like-charged solute species (i,j), with i < j, stored as
+    //! n = m_kk*i + j, in increasing order. Only pairs with a nonzero theta
+    //! parameter or with charges of different magnitude (for which the
+    //! E-theta terms are nonzero) are included, so Phi is zero for all other
+    //! pairs.
+    std::vector<size_t> m_LikeChargePairs;
+
+    //! Union of #m_CationAnionPairs and #m_LikeChargePairs, in increasing
+    //! order
+    std::vector<size_t> m_ChargedPairs;
+
+    //! Species j for which the pair (i,j) is in #m_CationAnionPairs, grouped
+    //! by species i. The species for species i are in positions
+    //! `m_CMXStart[i]` to `m_CMXStart[i+1] - 1`, in increasing order.
+    std::vector<size_t> m_CMXPartners;
+
+    //! Offsets into m_CMXPartners for each species. Length m_kk + 1.
+    std::vector<size_t> m_CMXStart;
+
+    //! Locations `n = k + j * m_kk + i * m_kk * m_kk` of the ternary
+    //! interaction parameters Psi_ijk (including the Zeta parameters) which
+    //! may be nonzero, in increasing order
+    std::vector<size_t> m_PsiIndex;
+
+    //! Species k for which Psi_ijk may be nonzero, grouped by the pair
+    //! (i,j). The species for the pair (i,j) are in positions
+    //! `m_PsiStart_ij[m_kk*i + j]` to `m_PsiStart_ij[m_kk*i + j + 1] - 1`,
+    //! in increasing order.
+    std::vector<size_t> m_PsiK_ij;
+
+    //! Offsets into m_PsiK_ij for each pair (i,j). Length m_kk*m_kk + 1.
+    std::vector<size_t> m_PsiStart_ij;
+
+    //! Species j for which Psi_ijk may be nonzero, grouped by the pair
+    //! (i,k). The species for the pair (i,k) are in positions
+    //! `m_PsiStart_ik[m_kk*i + k]` to `m_PsiStart_ik[m_kk*i + k + 1] - 1`,
+    //! in increasing order.
+    std::vector<size_t> m_PsiJ_ik;
+
+    //! Offsets into m_PsiJ_ik for each pair (i,k). Length m_kk*m_kk + 1.
+    std::vector<size_t> m_PsiStart_ik;
+    //! @}
+
     //! This is elambda, MEC
     mutable double elambda[17];
 
@@ -3142,6 +3200,15 @@ private:
      */
     void counterIJ_setup() const;
 
+    //! Build the lists of the interactions between solute species which
+    //! may be nonzero.
+    /*!
+     * A binary or ternary interaction is included if its current value or
+     * any of its temperature coefficients is nonzero. This must be called
+     * after all of the Pitzer parameters are set.
+     */
+    void interactionLists_setup();
+
     //! Calculate the cropped molalities
     /*!
      * This is an internal routine that calculates values
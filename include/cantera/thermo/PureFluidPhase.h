@@ -228,6 +228,26 @@ public:
     //! Returns a reference to the substance object
     tpx::Substance& TPX_Substance();
 
+    //! Solve for a sequence of states, each given by a pair of property
+    //! values.
+    /*!
+     * This is equivalent to setting the state of the phase successively with
+     * each pair of values, but avoids the overhead of updating the phase
+     * between the states, and uses a table of the saturation curve to speed
+     * up the iterative solution (see tpx::Substance::setStates). Properties
+     * other than pressure are specific (per unit mass), as in the
+     * setState_XY methods. On return, the phase is in the last state.
+     *
+     * @param XY  Property pair specifying the states
+     * @param n   Number of states
+     * @param x   Values of the first property. Length *n*.
+     * @param y   Values of the second property. Length *n*.
+     * @param[out] T    Temperature of each state (K). Length *n*.
+     * @param[out] rho  Density of each state (kg/m^3). Length *n*.
+     */
+    void setStates(tpx::PropertyPair::type XY, size_t n, const doublereal* x,
+                   const doublereal* y, doublereal* T, doublereal* rho);
+
     //@}
     /// @name Properties of the Standard State of the Species in the Solution
     /*!
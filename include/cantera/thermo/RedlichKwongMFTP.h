@@ -595,9 +595,19 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the temperature.
      *  This function updates the internal numbers based on the state of the object.
+     *  Nothing is recomputed if neither the temperature nor the composition
+     *  (as indicated by stateMFNumber()) has changed since the last call.
      */
     void updateAB();
 
+    //! Force the a and b parameters and the quantities derived from them to
+    //! be recomputed. Called whenever the species parameters change.
+    void resetMixingCache();
+
+    //! Compute the critical properties of the mixture at the current
+    //! composition, if they are not already known.
+    void updateCriticalConditions() const;
+
     //!  Calculate the a and the b parameters given the temperature
     /*!
      *  This function doesn't change the internal state of the object, so it is a const
@@ -657,6 +667,39 @@ protected:
      */
     doublereal m_a_current;
 
+    //! Temperature-independent part of a for the current composition
+    doublereal m_a0_current;
+
+    //! Derivative of a with respect to temperature for the current composition
+    doublereal m_dadT_current;
+
+    //! Values of \f$ \sum_i X_i a_{ki} \f$ at the current temperature and
+    //! composition. Updated by updateAB().
+    vector_fp m_aSum;
+
+    //! Temperature derivatives of the elements of m_aSum
+    vector_fp m_aSum_T;
+
+    //! Temperature at which a_vec_Curr_ and m_aSum were last evaluated
+    doublereal m_tempAB;
+
+    //! Value of stateMFNumber() when m_a_current and m_b_current were last
+    //! evaluated
+    int m_stateNumAB;
+
+    //! True if the critical properties below correspond to the current
+    //! composition
+    mutable bool m_critValid;
+
+    //! Critical temperature of the mixture
+    mutable doublereal m_tc_current;
+
+    //! Critical pressure of the mixture
+    mutable doublereal m_pc_current;
+
+    //! Critical molar volume of the mixture
+    mutable doublereal m_vc_current;
+
     vector_fp a_vec_Curr_;
     vector_fp b_vec_Curr_;
 
@@ -670,6 +713,14 @@ protected:
 
     doublereal Vroot_[3];
 
+    //! @name Inputs for which NSolns_ and Vroot_ were last computed
+    //! @{
+    doublereal m_rootsTemp;
+    doublereal m_rootsPres;
+    doublereal m_rootsA;
+    doublereal m_rootsB;
+    //! @}
+
     //! Temporary storage - length = m_kk.
     mutable vector_fp m_pp;
 
@@ -13,6 +13,7 @@
 #define WATERPROPSIAPWS_H
 
 #include "WaterPropsIAPWSphi.h"
+#include "WaterPropsIAPWSTable.h"
 
 namespace Cantera
 {
@@ -153,6 +154,11 @@ namespace Cantera
  * be sure that the underlying state of this object doesn't change except due
  * to the three function calls listed above.
  *
+ * The density() and psat() calculations can optionally start from values
+ * interpolated from a WaterPropsIAPWSTable, which is considerably faster for
+ * applications that evaluate the properties of water many times. See
+ * setTable().
+ *
  * @ingroup thermoprops
  */
 class WaterPropsIAPWS
@@ -363,6 +369,35 @@ public:
      */
     doublereal psat(doublereal temperature, int waterState = WATER_LIQUID);
 
+    //! Use tabulated values as the starting point for the density() and
+    //! psat() calculations.
+    /*!
+     * Where (T,P) is within the range of the table, density() refines the
+     * interpolated density with a few Newton iterations, instead of solving
+     * for the density from a generic initial guess, and psat() starts from
+     * the interpolated saturation pressure. The results agree with those
+     * computed without the table to within the convergence tolerances of the
+     * solvers. Outside the range of the table, the properties are computed
+     * as usual.
+     *
+     * @param table  Table to use, or 0 to compute all properties directly
+     *     from the equation of state (the default). The table is not owned
+     *     by this object, and must outlive it.
+     */
+    void setTable(const WaterPropsIAPWSTable* table) {
+        m_table = table;
+    }
+
+    //! Use the default table (see WaterPropsIAPWSTable::defaultTable()) as
+    //! the starting point for the density() and psat() calculations.
+    /*!
+     * The table is built the first time this is called with *flag* = true.
+     * @param flag  If false, stop using a table.
+     */
+    void useTable(bool flag = true) {
+        setTable(flag ? &WaterPropsIAPWSTable::defaultTable() : 0);
+    }
+
     //! Return the value of the density at the water spinodal point (on the liquid side)
     //! for the current temperature.
     /*!
@@ -462,6 +497,10 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! Tabulated properties used as the starting point for density() and
+    //! psat(). Not owned by this object.
+    const WaterPropsIAPWSTable* m_table;
 };
 
 }
@@ -0,0 +1,150 @@
+/**
+ * @file WaterPropsIAPWSTable.h
+ * Tabulated density and saturation properties of water, used to accelerate
+ * the IAPWS 1995 formulation (see class
+ * \link Cantera::WaterPropsIAPWSTable WaterPropsIAPWSTable\endlink).
+ */
+#ifndef WATERPROPSIAPWSTABLE_H
+#define WATERPROPSIAPWSTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Tables of the density and the saturation properties of water, computed
+//! from the IAPWS 1995 formulation.
+/*!
+ * Finding the density of water at a given temperature and pressure requires
+ * an iterative solution of the IAPWS 1995 equation of state, which is the
+ * most expensive part of evaluating the properties of water with
+ * WaterPropsIAPWS. This class holds separate tables of the density of the
+ * liquid and of the vapor on a grid that is uniform in \f$ T \f$ and in
+ * \f$ \ln P \f$, and a table of the saturation pressure and the densities of
+ * the saturated liquid and vapor as a function of temperature. The tables
+ * are filled in once, when the object is constructed.
+ *
+ * The logarithms of the density and of the saturation pressure are
+ * interpolated with cubic Hermite polynomials (bicubic for the density
+ * tables), using derivatives at the grid points computed from the equation
+ * of state. Each cell of the tables is checked against the exact
+ * formulation at its center and at the midpoints of its edges, and cells
+ * where the relative error exceeds the tolerance given to the constructor
+ * are not used. This excludes, for instance, the regions where one of the
+ * phases does not exist.
+ *
+ * The tables are used by WaterPropsIAPWS (see WaterPropsIAPWS::setTable())
+ * to provide the initial guesses for the density and saturation pressure
+ * calculations, which are then refined with a few Newton iterations on the
+ * exact formulation. The results therefore agree with those computed
+ * without the tables to within the convergence tolerance of the solvers.
+ *
+ * @ingroup thermoprops
+ */
+class WaterPropsIAPWSTable
+{
+public:
+    //! Build the tables.
+    /*!
+     * The temperature range must be below the critical temperature.
+     *
+     * @param Tmin  Minimum temperature (kelvin)
+     * @param Tmax  Maximum temperature (kelvin)
+     * @param nT    Number of temperature grid points
+     * @param Pmin  Minimum pressure (Pascal)
+     * @param Pmax  Maximum pressure (Pascal)
+     * @param nP    Number of pressure grid points
+     * @param rtol  Maximum relative error of the interpolated values
+     */
+    WaterPropsIAPWSTable(doublereal Tmin = 273.16, doublereal Tmax = 623.15,
+                         size_t nT = 71, doublereal Pmin = 1.0E3,
+                         doublereal Pmax = 1.0E8, size_t nP = 41,
+                         doublereal rtol = 1.0E-5);
+
+    //! Interpolated density (kg m-3) of one of the phases of water
+    /*!
+     * @param T      Temperature (kelvin)
+     * @param P      Pressure (Pascal)
+     * @param phase  Either WATER_LIQUID or WATER_GAS
+     * @return the density, or -1.0 if (T,P) is outside of the valid part
+     *     of the table for this phase.
+     */
+    doublereal density(doublereal T, doublereal P, int phase) const;
+
+    //! Interpolated saturation pressure (Pascal)
+    /*!
+     * @param T  Temperature (kelvin)
+     * @param[out] densLiq  Density of the saturated liquid (kg m-3)
+     * @param[out] densGas  Density of the saturated vapor (kg m-3)
+     * @return the saturation pressure, or -1.0 if T is outside of the
+     *     table.
+     */
+    doublereal psat(doublereal T, doublereal& densLiq,
+                    doublereal& densGas) const;
+
+    //! Largest relative error of the interpolated values found when the
+    //! tables were checked, among the cells that are used
+    doublereal maxError() const {
+        return m_maxError;
+    }
+
+    //! Fraction of the cells of the liquid and vapor density tables that are
+    //! used
+    doublereal coverage() const;
+
+    //! A table covering the default temperature and pressure ranges. It is
+    //! built the first time it is requested.
+    static const WaterPropsIAPWSTable& defaultTable();
+
+private:
+    //! Interpolate a bicubic table at (T, lnP). Returns false if the cell
+    //! containing this point is not used.
+    bool interpolate(size_t phase, doublereal T, doublereal lnP,
+                     doublereal& value) const;
+
+    //! Fill in the node values and derivatives for one phase
+    void buildPhase(size_t phase);
+
+    //! Check the cells of one phase against the exact formulation
+    void checkPhase(size_t phase);
+
+    //! Fill in and check the saturation table
+    void buildSaturation();
+
+    doublereal m_Tmin;
+    doublereal m_Tmax;
+    doublereal m_dT;
+    size_t m_nT;
+    doublereal m_lnPmin;
+    doublereal m_lnPmax;
+    doublereal m_dlnP;
+    size_t m_nP;
+    doublereal m_rtol;
+    doublereal m_maxError;
+
+    //! Logarithm of the density at each node, for the liquid [0] and the
+    //! vapor [1]. Node (i,j) at T_i and lnP_j is stored at i*m_nP + j.
+    vector_fp m_lnRho[2];
+    //! Derivative of ln(rho) with respect to T at each node
+    vector_fp m_dT_lnRho[2];
+    //! Derivative of ln(rho) with respect to ln(P) at each node
+    vector_fp m_dP_lnRho[2];
+    //! Cross derivative of ln(rho) with respect to T and ln(P) at each node
+    vector_fp m_dTP_lnRho[2];
+    //! Whether each node has a solution on the right branch
+    std::vector<int> m_nodeOK[2];
+    //! Whether each cell is used. Cell (i,j) has the lower corner at node
+    //! (i,j) and is stored at i*m_nP + j.
+    std::vector<int> m_cellOK[2];
+
+    //! ln(psat) at each temperature node and its temperature derivative
+    vector_fp m_lnPsat, m_dlnPsat;
+    //! ln(rho) of the saturated liquid and vapor at each temperature node,
+    //! and their temperature derivatives
+    vector_fp m_lnRhoSat[2], m_dlnRhoSat[2];
+    //! Whether each interval of the saturation table is used
+    std::vector<int> m_satOK;
+};
+
+}
+#endif
@@ -123,6 +123,25 @@ public:
      */
     doublereal dfind(doublereal p_red, doublereal tau, doublereal deltaGuess);
 
+    //! Find the reduced density starting from an accurate initial guess.
+    /*!
+     * This uses undamped Newton iterations, and is intended to refine a
+     * density which is already within a small fraction of the solution, for
+     * instance one interpolated from a WaterPropsIAPWSTable. The convergence
+     * criteria are the same as for dfind().
+     *
+     * @param p_red       Value of the dimensionless pressure
+     * @param tau         Dimensionless temperature = T_c/T
+     * @param deltaGuess  Initial guess for the dimensionless density
+     *
+     * @return
+     *   Returns the dimensionless density, or 0.0 if the iteration does not
+     *   converge within a few steps or reaches a mechanically unstable state.
+     *   The caller should then fall back to dfind().
+     */
+    doublereal dfindNewton(doublereal p_red, doublereal tau,
+                           doublereal deltaGuess);
+
     //! Calculate the dimensionless gibbs free energy
     doublereal gibbs_RT() const;
 
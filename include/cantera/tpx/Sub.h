@@ -4,6 +4,7 @@
 
 #include "cantera/base/ctexceptions.h"
 #include <algorithm>
+#include <vector>
 
 namespace tpx
 {
@@ -223,6 +224,54 @@ public:
     //! second property.
     void Set(PropertyPair::type XY, double x0, double y0);
 
+    //! @name Evaluation of Multiple States
+    //! @{
+
+    //! Set a sequence of states, each given by a pair of property values.
+    /*!
+     * For each *i* < *n*, the state is set with `Set(XY, x0[i], y0[i])`, and
+     * the resulting temperature and specific volume are stored in `t[i]` and
+     * `v[i]`. Any other property of state *i* can then be obtained by
+     * setting the state with the TV property pair, which does not require an
+     * iterative solution. Each state is solved starting from the previous
+     * one, so ordering the states so that neighboring states are close
+     * reduces the number of iterations needed. On return, the substance is
+     * left in the last state.
+     *
+     * The saturation curve is tabulated with buildSatTable() before the
+     * first call, if it has not been done already.
+     *
+     * @param XY  Property pair specifying the states
+     * @param n   Number of states
+     * @param x0  Values of the first property. Length *n*.
+     * @param y0  Values of the second property. Length *n*.
+     * @param[out] t  Temperature [K] of each state. Length *n*.
+     * @param[out] v  Specific volume [m^3/kg] of each state. Length *n*.
+     */
+    void setStates(PropertyPair::type XY, size_t n, const double* x0,
+                   const double* y0, double* t, double* v);
+
+    //! Tabulate the saturation curve.
+    /*!
+     * The saturation pressure and the densities of the saturated liquid and
+     * vapor are computed at *nT* temperatures evenly spaced between Tmin()
+     * and Tcrit(). The table is then interpolated to provide the starting
+     * values for the iterative calculations of the saturation state at other
+     * temperatures, and of the saturation temperature. The results are the
+     * same as those obtained without the table to within the convergence
+     * tolerance of these calculations, but they usually take only one or two
+     * iterations.
+     *
+     * @param nT  Number of temperatures in the table
+     */
+    void buildSatTable(size_t nT = 200);
+
+    //! Returns true if the saturation curve has been tabulated
+    bool hasSatTable() const {
+        return m_satDT > 0.0;
+    }
+    //! @}
+
 protected:
     double T, Rho;
     double Tslast, Rhf, Rhv;
@@ -258,6 +307,16 @@ protected:
     //! Update saturated liquid and vapor densities and saturation pressure
     void update_sat();
 
+    //! Interpolate the saturation pressure and the densities of the saturated
+    //! liquid and vapor at temperature *t* from the saturation table. Returns
+    //! false if there is no table or *t* is outside of it.
+    bool satTableEstimate(double t, double& ps, double& rhf, double& rhv);
+
+    //! Interpolate the saturation temperature at pressure *p* from the
+    //! saturation table. Returns -1.0 if there is no table or *p* is outside
+    //! of it.
+    double satTableTsat(double p);
+
 private:
     void set_Rho(double r0);
     void set_T(double t0);
@@ -273,6 +332,18 @@ private:
     double Pmin, Pmax;
     double dvbf, dv;
     double v_here, P_here;
+
+    //! @name Saturation table
+    //! Node *i* is at temperature `m_satT0 + i*m_satDT`. The logarithm of the
+    //! saturation pressure and of the saturated vapor density are
+    //! interpolated linearly in 1/T, and the saturated liquid density
+    //! linearly in T.
+    //! @{
+    double m_satT0, m_satDT;
+    std::vector<double> m_satLnP;
+    std::vector<double> m_satRhf;
+    std::vector<double> m_satLnRhv;
+    //! @}
 };
 
 }
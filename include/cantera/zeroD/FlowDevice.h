@@ -10,10 +10,10 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/global.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/numerics/Func1.h"
 
 namespace Cantera
 {
-class Func1;
 class ReactorBase;  // forward reference
 
 const int MFC_Type = 1;
@@ -91,7 +91,9 @@ public:
 
     //! Set a function of a single variable that is used in determining the
     //! mass flow rate through the device. The meaning of this function
-    //! depends on the parameterization of the derived type.
+    //! depends on the parameterization of the derived type. The function is
+    //! compiled when it is set, so changes to its structure made afterwards
+    //! have no effect.
     void setFunction(Cantera::Func1* f);
 
     //! Set the fixed mass flow rate (kg/s) through the flow device.
@@ -102,6 +104,9 @@ public:
 protected:
     doublereal m_mdot;
     Cantera::Func1* m_func;
+
+    //! Compiled form of #m_func, used to evaluate it
+    CompiledFunc1 m_funcCode;
     vector_fp m_coeffs;
     int m_type;
 
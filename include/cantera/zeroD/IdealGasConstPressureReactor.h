@@ -46,6 +46,8 @@ public:
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
+    virtual size_t energyRateDerivs(double* dEdw);
+
     vector_fp m_hk; //!< Species molar enthalpies
 };
 }
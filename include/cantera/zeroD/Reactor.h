@@ -75,6 +75,21 @@ public:
         m_chem = true;
     }
 
+    //! Returns `true` if changes in reactor composition due to chemical
+    //! reactions are enabled.
+    bool chemistryEnabled() const {
+        return m_chem;
+    }
+
+    //! Return a reference to the kinetics manager for the reactor contents.
+    Kinetics& kinetics() {
+        if (!m_kin) {
+            throw CanteraError("Reactor::kinetics",
+                               "No kinetics manager defined.");
+        }
+        return *m_kin;
+    }
+
     //! Set the energy equation on or off.
     void setEnergy(int eflag = 1) {
         if (eflag > 0) {
@@ -128,6 +143,27 @@ public:
     //! (in the homogeneous phase).
     virtual void addSensitivityReaction(size_t rxn);
 
+    //! Evaluate the derivatives of the governing equations with respect to
+    //! the multipliers of the reactions added with addSensitivityReaction().
+    /*!
+     *  The derivative of the net production rate of species \f$ k \f$ with
+     *  respect to the multiplier of reaction \f$ i \f$ is
+     *  \f$ \nu_{k,i} \dot{q}_i \f$, where \f$ \nu_{k,i} \f$ is the net
+     *  stoichiometric coefficient and \f$ \dot{q}_i \f$ is the net rate of
+     *  progress, so these derivatives are found without evaluating the
+     *  governing equations for each parameter. Called by
+     *  ReactorNet::evalParamJacobian() after the state of the reactor has
+     *  been set.
+     *
+     *  @param[out] dfdp Column-major array with leading dimension *ld*. Rows
+     *      0 to neq()-1 of column *n* are set to the derivatives with respect
+     *      to the *n*-th reaction multiplier.
+     *  @returns the number of reaction multipliers, which are the first
+     *      sensitivity parameters of this reactor. The derivatives with
+     *      respect to the parameters of walls are not computed.
+     */
+    virtual size_t evalReactionParamDerivs(double* dfdp, size_t ld);
+
     //! Return a vector specifying the ordering of objects to use when
     //! determining sensitivity parameter indices.
     /*!
@@ -153,6 +189,17 @@ protected:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Get the derivatives of the time derivative of the energy variable
+    //! with respect to the net production rates of the gas phase species.
+    //! Used by evalReactionParamDerivs().
+    //! @param[out] dEdw  Array of length nSpecies()
+    //! @returns the index of the energy variable in the solution vector for
+    //!     this reactor, or npos if its time derivative does not depend on
+    //!     the production rates.
+    virtual size_t energyRateDerivs(double* dEdw) {
+        return npos;
+    }
+
     //! Return the index in the solution vector for this reactor of the species
     //! named *nm*, in either the homogeneous phase or a surface phase, relative
     //! to the start of the species terms. Used to implement componentIndex for
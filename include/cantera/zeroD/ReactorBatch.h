@@ -0,0 +1,166 @@
+/**
+ *  @file ReactorBatch.h
+ *  Header file for class ReactorBatch.
+ */
+
+#ifndef CT_REACTORBATCH_H
+#define CT_REACTORBATCH_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/ct_thread.h"
+
+namespace Cantera
+{
+
+class BatchWorker;
+
+//! Integrates many independent homogeneous reactors over the same time
+//! interval.
+/*!
+ *  This class is intended for operator-split reacting flow simulations,
+ *  where the chemistry in each cell is integrated separately for each time
+ *  step of the flow solver. Each thread used by the batch has its own
+ *  phase, kinetics manager, reactor and ReactorNet, which are reused for
+ *  every cell it integrates. The integrator is reinitialized for each cell
+ *  rather than being created again, so its memory is only allocated once.
+ *
+ *  The cells are distributed dynamically: each thread takes the next few
+ *  cells from a shared queue whenever it finishes its current ones, so that
+ *  threads which get stiff cells take fewer of them. The cells are queued in
+ *  decreasing order of the number of right-hand side evaluations they needed
+ *  in the previous call to advance(), so that the most expensive cells are
+ *  started first and do not delay the end of the batch.
+ *
+ *  The state of each cell is given by its temperature, pressure and mass
+ *  fractions. For constant volume reactor types, the pressure returned is the
+ *  one at the end of the time step.
+ */
+class ReactorBatch
+{
+public:
+    //! Create a batch for cells containing the phase *id* in the input file
+    //! *infile*, integrated using reactors of type *reactorType* (see
+    //! ReactorFactory).
+    ReactorBatch(const std::string& infile, const std::string& id="",
+                 const std::string& reactorType="IdealGasConstPressureReactor");
+    virtual ~ReactorBatch();
+
+    //! Number of species in the phase
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Number of values in the state of each cell (nSpecies() + 2)
+    size_t stateSize() const {
+        return m_nsp + 2;
+    }
+
+    //! Set the number of threads used to integrate the cells. The default is
+    //! one, in which case the cells are integrated in the calling thread.
+    void setThreads(size_t n);
+
+    //! Number of threads used to integrate the cells
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Set the number of cells which are taken from the queue at a time by
+    //! each thread.
+    void setChunkSize(size_t n);
+
+    //! Set the relative and absolute tolerances for the integrator.
+    void setTolerances(double rtol, double atol);
+
+    //! Enable or disable the energy equation for each reactor.
+    void setEnergy(bool enable);
+
+    //! Set the integrator used for each reactor. See
+    //! ReactorNet::setIntegratorType().
+    void setIntegratorType(const std::string& type);
+
+    //! Advance each cell by time *dt*.
+    /*!
+     *  @param ncells Number of cells
+     *  @param state  Array with the state of each cell, which is replaced by
+     *      the state at the end of the time step. The state of cell *i*
+     *      starts at `state[i * stateSize()]`, and consists of the
+     *      temperature [K], the pressure [Pa], and the mass fractions of
+     *      each species.
+     *  @param dt     Time step [s]
+     *
+     *  If the integration fails for any cell, the remaining cells are still
+     *  integrated, after which a CanteraError is thrown describing the first
+     *  failed cell. The states of the failed cells are left unchanged.
+     */
+    void advance(size_t ncells, double* state, double dt);
+
+    //! Number of right-hand side evaluations needed for cell *i* in the
+    //! last call to advance()
+    int nEvals(size_t i) const {
+        return m_cost.at(i);
+    }
+
+    //! Number of cells integrated by each thread in the last call to
+    //! advance()
+    const std::vector<size_t>& cellsPerThread() const {
+        return m_ncells;
+    }
+
+protected:
+    //! Integrate the cells taken from the queue by worker *n* until there
+    //! are none left. Called by each thread.
+    void work(size_t n);
+
+    //! Take the next chunk of cells from the queue.
+    //! @returns `false` if there are no cells left.
+    bool nextChunk(size_t& begin, size_t& end);
+
+    //! Arguments for the function run by each thread
+    struct ThreadArgs {
+        ReactorBatch* batch;
+        size_t n;
+    };
+
+    static void runWorker(void* args);
+
+    //! Wait for each of the *threads* to finish, and delete them
+    static void joinThreads(std::vector<thread_t*>& threads);
+
+    std::string m_infile;
+    std::string m_id;
+    std::string m_reactorType;
+    size_t m_nsp;
+
+    std::vector<BatchWorker*> m_workers;
+
+    size_t m_chunk; //!< number of cells taken at a time
+    double m_rtol;
+    double m_atol;
+    bool m_energy;
+    std::string m_integType;
+
+    //! Number of RHS evaluations for each cell in the last call to advance()
+    std::vector<int> m_cost;
+
+    //! Order in which the cells are integrated
+    std::vector<size_t> m_order;
+
+    //! Number of cells integrated by each worker
+    std::vector<size_t> m_ncells;
+
+    // State of the current call to advance(), shared by the workers
+    double* m_state;
+    double m_dt;
+    size_t m_next; //!< index in #m_order of the next cell to integrate
+    size_t m_failedCell; //!< first cell for which integration failed
+    std::string m_failure; //!< error message for #m_failedCell
+    mutex_t m_mutex; //!< protects #m_next, #m_failedCell and #m_failure
+
+private:
+    ReactorBatch(const ReactorBatch&);
+    ReactorBatch& operator=(const ReactorBatch&);
+};
+
+}
+
+#endif
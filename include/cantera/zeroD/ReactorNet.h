@@ -9,11 +9,13 @@
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
 #include "cantera/numerics/Integrator.h"
-#include "cantera/base/Array.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
 {
 
+class ReactorRecorder;
+
 //! A class representing a network of connected reactors.
 /*!
  *  This class is used to integrate the time-dependent governing equations for
@@ -75,6 +77,95 @@ public:
         m_init = false;
     }
 
+    //! Enable or disable integration of the forward sensitivity equations.
+    /*!
+     *  By default, the sensitivities of all of the solution components with
+     *  respect to each parameter added with Reactor::addSensitivityReaction()
+     *  are integrated along with the solution. When only the sensitivities of
+     *  a few scalar outputs are needed, they can be computed much more
+     *  cheaply with advanceAdjoint() after disabling the forward
+     *  sensitivities.
+     */
+    void setForwardSensitivities(bool enable) {
+        m_forwardSens = enable;
+        m_init = false;
+    }
+
+    //! Returns `true` if the forward sensitivity equations are integrated.
+    bool forwardSensitivities() const {
+        return m_forwardSens;
+    }
+
+    //! Set the number of forward time steps between the checkpoints stored
+    //! by advanceAdjoint(). Smaller intervals use less memory, at the cost
+    //! of recomputing more of the forward solution from the checkpoints.
+    void setAdjointCheckpointInterval(size_t nsteps) {
+        if (nsteps == 0) {
+            throw CanteraError("ReactorNet::setAdjointCheckpointInterval",
+                               "The interval must be at least one step.");
+        }
+        m_adjointInterval = nsteps;
+    }
+
+    //! Number of forward time steps between the checkpoints stored by
+    //! advanceAdjoint().
+    size_t adjointCheckpointInterval() const {
+        return m_adjointInterval;
+    }
+
+    //! Enable or disable the use of evalSensitivities() for the right-hand
+    //! sides of the forward sensitivity equations.
+    /*!
+     *  By default, the integrator computes the right-hand side for each
+     *  parameter by a centered directional finite difference of eval(),
+     *  which costs two evaluations of eval() per parameter. Instead,
+     *  evalSensitivities() computes a finite difference Jacobian, which
+     *  costs neq() evaluations of eval() and is reused while the state does
+     *  not change, plus a matrix-vector product for each parameter.
+     *
+     *  For an IdealGasReactor, one evaluation of evalSensitivities() at a
+     *  new state costs about as much as the finite differences for
+     *  neq()/4 parameters: 4 to 5 parameters for h2o2.xml (neq() = 12)
+     *  and 13 to 14 parameters for gri30.xml (neq() = 56). With more
+     *  parameters than this, enabling the sensitivity equations reduces the
+     *  cost of the sensitivity right-hand sides. They are disabled by
+     *  default because most sensitivity studies use only a few parameters.
+     */
+    void setSensitivityEquations(bool enable) {
+        m_sensEquations = enable;
+        m_init = false;
+    }
+
+    //! Returns `true` if evalSensitivities() is used for the forward
+    //! sensitivity equations.
+    bool sensitivityEquations() const {
+        return m_sensEquations;
+    }
+
+    //! Set the integrator used to integrate the network.
+    /*!
+     *  @param type One of the integrator types recognized by newIntegrator():
+     *      `CVODE` (the default), `Rosenbrock` for a linearly-implicit
+     *      method which is cheap to restart, or `RungeKutta` for an explicit
+     *      method suitable for non-stiff problems. Sensitivity analysis
+     *      requires `CVODE`.
+     *
+     *  `Rosenbrock` pays off when the integration is restarted often, for
+     *  example with setInitialTime(), because it starts at its full order
+     *  with an estimated initial step size, while `CVODE` starts again at
+     *  first order with a small step. With the `reactor_batch` sample (GRI-Mech 3.0, rtol = 1e-9),
+     *  restarting each reactor every 1e-7 s, `Rosenbrock` integrates 1.2 to
+     *  1.7 times more reactors per second than `CVODE`. The two are even
+     *  when restarting every 1e-6 s, and `CVODE` is 3 to 5 times faster
+     *  when restarting every 1e-5 s.
+     */
+    void setIntegratorType(const std::string& type);
+
+    //! The integrator type set by setIntegratorType()
+    const std::string& integratorType() const {
+        return m_integType;
+    }
+
     //! Current value of the simulation time.
     doublereal time() {
         return m_time;
@@ -111,6 +202,175 @@ public:
     //! toward *time*.
     double step(doublereal time);
 
+    //! Advance the state of all reactors to time *tf*, and compute the
+    //! sensitivities of a scalar output with respect to all of the
+    //! sensitivity parameters using the adjoint method.
+    /*!
+     *  The output is a weighted sum of the components of the global state
+     *  vector \f$ y \f$ at time \f$ t_f \f$ and of their integrals from the
+     *  current time \f$ t_0 \f$:
+     *
+     *  \f[ G = a^T y(t_f) + \int_{t_0}^{t_f} b^T y \, dt \f]
+     *
+     *  which includes, for example, the final temperature of an
+     *  IdealGasReactor or the time integral of a species mass fraction.
+     *
+     *  The solution is first integrated forward to \f$ t_f \f$, storing a
+     *  checkpoint every setAdjointCheckpointInterval() internal time steps.
+     *  The adjoint equations
+     *
+     *  \f[ \frac{d\lambda}{dt} = -J^T \lambda - b, \qquad
+     *      \lambda(t_f) = a \f]
+     *
+     *  are then integrated backward in time, one checkpoint interval at a
+     *  time. The forward solution within each interval is recomputed from
+     *  its checkpoint, and the Jacobian \f$ J \f$ is evaluated by finite
+     *  differences once at each recomputed state and linearly interpolated
+     *  within each step. Only the two most recent intervals are kept, so the
+     *  memory used is proportional to the interval times neq()*neq(), plus
+     *  neq() values per checkpoint. The sensitivities are found from the
+     *  quadrature
+     *
+     *  \f[ \frac{dG}{dp_i} = \int_{t_0}^{t_f} \lambda^T
+     *      \frac{\partial f}{\partial p_i} \, dt \f]
+     *
+     *  The cost of the backward integration does not depend on the number of
+     *  parameters, so this is much cheaper than integrating the forward
+     *  sensitivity equations when there are many parameters. The accuracy of
+     *  the adjoint solution is controlled by the sensitivity tolerances. See
+     *  setForwardSensitivities().
+     *
+     *  @param tf  Time to advance to (s).
+     *  @param a   Weights for the state vector at time *tf*. Length neq(),
+     *             or empty if the output does not include the final state.
+     *  @param b   Weights for the integral of the state vector. Length neq(),
+     *             or empty if the output does not include an integral.
+     *  @param[out] dGdp  Derivatives of \f$ G \f$ with respect to each
+     *      sensitivity parameter, in the order in which they were added.
+     *      Since each parameter is a multiplier with a nominal value of 1,
+     *      these are also the derivatives with respect to the logarithms of
+     *      the parameters. They are not normalized by \f$ G \f$.
+     */
+    void advanceAdjoint(double tf, const vector_fp& a, const vector_fp& b,
+                        vector_fp& dGdp);
+
+    //! Add an event at which advanceToEvent() stops the integration.
+    /*!
+     *  The event occurs when solution component *k* (if *derivative* is 0)
+     *  or its time derivative (if *derivative* is 1) crosses *value*. For
+     *  example, the ignition delay can be defined by the temperature of an
+     *  IdealGasReactor crossing a threshold, and the time of the maximum
+     *  mass fraction of a species is the event where the time derivative of
+     *  its mass fraction crosses zero with *direction* = -1.
+     *
+     *  @param k  Index of the component in the global state vector
+     *  @param value  Value of the component or its derivative at the event
+     *  @param direction  If positive, only crossings where the component is
+     *      increasing are events; if negative, only those where it is
+     *      decreasing. If zero, both are events.
+     *  @param derivative  0 to use the value of the component; 1 to use its
+     *      time derivative
+     *  @returns the index of the event, as returned by lastEvent()
+     */
+    size_t addEvent(size_t k, double value, int direction=0,
+                    int derivative=0);
+
+    //! Add an event on the component named *component* in the reactor with
+    //! index *reactor*.
+    //! @copydetails ReactorNet::addEvent(size_t, double, int, int)
+    size_t addEvent(const std::string& component, double value,
+                    int direction=0, int derivative=0, int reactor=0) {
+        return addEvent(globalComponentIndex(component, reactor), value,
+                        direction, derivative);
+    }
+
+    //! Remove all of the events added with addEvent().
+    void clearEvents() {
+        m_events.clear();
+        m_event_g.clear();
+        m_lastEvent = npos;
+    }
+
+    //! Number of events added with addEvent().
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! Advance the state of all reactors in time until *time* or the first
+    //! event added with addEvent(), whichever comes first.
+    /*!
+     *  After each internal time step, the event functions are evaluated at
+     *  the end of the step. If any has changed sign, the time of the event is
+     *  located within the step by a root-finding iteration on the
+     *  interpolating polynomial of the integrator (see getDenseOutput()), so
+     *  no additional time steps are taken, and the reactors are left in the
+     *  state at the time of the event. Integration can be continued with
+     *  another call to advanceToEvent(), which will not report the same
+     *  event again.
+     *
+     *  @param time  Time to advance to (s)
+     *  @returns the time reached. lastEvent() gives the index of the event
+     *      which stopped the integration, or npos if *time* was reached.
+     */
+    double advanceToEvent(double time);
+
+    //! Index of the event which stopped the last call to advanceToEvent(),
+    //! or npos if no event occurred.
+    size_t lastEvent() const {
+        return m_lastEvent;
+    }
+
+    //! Interpolate the global state vector, or its time derivatives, within
+    //! the last internal time step taken by the integrator.
+    /*!
+     *  This gives the solution at times between the output times of step()
+     *  without any additional integration. *t* must be within the last
+     *  internal step, which ends at or after time() and may begin before
+     *  it; *k* must not be larger than the order of the integration method
+     *  on that step (at least 1 after any step).
+     *
+     *  @param t  Time at which to evaluate the solution (s)
+     *  @param k  Order of the time derivative, or 0 for the state itself
+     *  @param[out] dky  Output array of length neq()
+     */
+    void getDenseOutput(double t, int k, double* dky) {
+        m_integ->getDenseOutput(t, k, dky);
+    }
+
+    //! Solve directly for the steady state of the reactor network.
+    /*!
+     *  Finds the state at which the time derivatives of all the solution
+     *  components vanish, using a damped Newton method on the network
+     *  residual. If the Newton iteration fails, a series of implicit
+     *  (backward Euler) pseudo-time steps is taken to move the solution
+     *  closer to the steady state before trying the Newton iteration again,
+     *  in the same way as Sim1D::solve(). Components whose time derivatives
+     *  are identically zero, such as the volume of a reactor with only rigid
+     *  walls, are held at their current values. The network time is not
+     *  changed, and integration with advance() or step() continues from the
+     *  steady-state solution.
+     *
+     *  The network must have an isolated steady state, which is generally
+     *  the case if each reactor exchanges mass with a reservoir, directly or
+     *  indirectly. A closed reactor has a continuum of steady states; its
+     *  equilibrium state can be found with ThermoPhase::equilibrate().
+     *
+     *  @param loglevel Controls the amount of diagnostic output.
+     */
+    void solveSteady(int loglevel=0);
+
+    //! Set the pseudo-time stepping used by solveSteady() when the Newton
+    //! iteration fails.
+    /*!
+     *  @param dt      Initial pseudo-time step (s).
+     *  @param nsteps  Number of pseudo-time steps to take before the Newton
+     *                 iteration is tried again.
+     */
+    void setSteadyTimeStep(doublereal dt, int nsteps) {
+        m_ss_dt = dt;
+        m_ss_nsteps = nsteps;
+    }
+
     //@}
 
     //! Add the reactor *r* to this reactor network.
@@ -141,6 +401,22 @@ public:
         m_verbose = v;
     }
 
+    //! Record the state of the reactors after each time step with the
+    //! ReactorRecorder *rec*, or stop recording if *rec* is NULL.
+    /*!
+     *  The recorder is not owned by the ReactorNet. If it does not contain
+     *  any rows, the state at the current time is recorded before the next
+     *  time step. advanceAdjoint() and solveSteady() do not record any rows.
+     */
+    void setRecorder(ReactorRecorder* rec) {
+        m_recorder = rec;
+    }
+
+    //! The recorder set by setRecorder(), or NULL.
+    ReactorRecorder* recorder() {
+        return m_recorder;
+    }
+
     //! Return a reference to the integrator.
     Integrator& integrator() {
         return *m_integ;
@@ -167,6 +443,10 @@ public:
         if (!m_init) {
             initialize();
         }
+        if (!m_forwardSens) {
+            throw CanteraError("ReactorNet::sensitivity",
+                               "Forward sensitivities are disabled.");
+        }
         return m_integ->sensitivity(k, m_sensIndex[p])/m_integ->solution(k);
     }
 
@@ -189,6 +469,23 @@ public:
     void evalJacobian(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p, Array2D* j);
 
+    //! Evaluate the derivatives of the time derivatives of the state vector
+    //! with respect to each of the sensitivity parameters.
+    /*!
+     *  The derivatives with respect to reaction rate multipliers are found
+     *  directly from the rates of progress (see
+     *  Reactor::evalReactionParamDerivs()), and those with respect to the
+     *  parameters of walls are found by finite differences.
+     *
+     *  @param[in] t Time at which to evaluate the derivatives
+     *  @param[in] y Global state vector at time *t*
+     *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
+     *  @param[out] dfdp Matrix of size neq() by nSensParams(), where
+     *      `dfdp(k,i)` is the derivative of `ydot[k]` with respect to the
+     *      *i*-th parameter in the order used by the integrator.
+     */
+    void evalParamJacobian(double t, double* y, double* ydot, Array2D* dfdp);
+
     // overloaded methods of class FuncEval
     virtual size_t neq() {
         return m_nv;
@@ -197,7 +494,31 @@ public:
                       doublereal* ydot, doublereal* p);
     virtual void getInitialConditions(doublereal t0, size_t leny,
                                       doublereal* y);
+    //! The number of sensitivity parameters seen by the integrator, which is
+    //! zero if the forward sensitivities are disabled.
     virtual size_t nparams() {
+        return (m_forwardSens) ? m_ntotpar : 0;
+    }
+
+    //! The sensitivity equations are evaluated by evalSensitivities() if
+    //! this is enabled with setSensitivityEquations().
+    virtual bool hasSensitivityEquations() {
+        return m_sensEquations;
+    }
+
+    //! Evaluate the right-hand sides of the forward sensitivity equations.
+    /*!
+     *  The Jacobian is computed by finite differences (once for all of the
+     *  parameters) and the derivatives with respect to the parameters are
+     *  computed by evalParamJacobian(), so the cost is nearly independent of
+     *  the number of parameters, unlike finite differences of eval() for
+     *  each parameter.
+     */
+    virtual void evalSensitivities(double t, double* y, double* ydot,
+                                   double** s, double** sdot);
+
+    //! The number of sensitivity parameters added to this ReactorNet.
+    size_t nSensParams() const {
         return m_ntotpar;
     }
 
@@ -236,8 +557,43 @@ protected:
      */
     void initialize();
 
+    //! Damped Newton iteration used by solveSteady().
+    /*!
+     *  Solves \f$ f(y) - r (y - y_{old}) = 0 \f$ for #m_ss_y, where \f$ f \f$
+     *  is the time derivative of the state vector and \f$ r \f$ is the
+     *  reciprocal of the pseudo-time step (zero for the steady problem).
+     *  @returns the number of iterations taken, or -1 if the iteration
+     *      failed, in which case #m_ss_y is left in an undefined state.
+     */
+    int steadyNewton(doublereal rdt, int loglevel);
+
+    //! Take *nsteps* backward Euler steps starting with step size *dt*,
+    //! reducing the step size after failures and increasing it after easy
+    //! steps. Returns the last step size. Used by solveSteady().
+    doublereal steadyTimeStep(int nsteps, doublereal dt, int loglevel);
+
+    //! Weighted root-mean-square norm of the Newton step *step* taken from
+    //! the state *y*, using the integrator tolerances.
+    doublereal steadyNorm(const doublereal* y, const doublereal* step) const;
+
+    //! Evaluate the steady-state residual and store it in *r*. Returns
+    //! `false` if the state *y* is not valid.
+    bool steadyResidual(doublereal* y, doublereal rdt, doublereal* r);
+
     std::vector<Reactor*> m_reactors;
     Integrator* m_integ;
+
+    //! Integrator for the adjoint equations, created by the first call to
+    //! advanceAdjoint()
+    Integrator* m_adjointInteg;
+
+    //! Integrator used by advanceAdjoint() to recompute the forward solution
+    //! from each checkpoint
+    Integrator* m_checkpointInteg;
+
+    //! Number of forward time steps between checkpoints in advanceAdjoint()
+    size_t m_adjointInterval;
+    std::string m_integType; //!< type of #m_integ
     doublereal m_time;
     bool m_init;
     bool m_integrator_init; //! True if integrator initialization is current
@@ -246,12 +602,19 @@ protected:
     //! m_start[n] is the starting point in the state vector for reactor n
     std::vector<size_t> m_start;
 
+    //! Global indices of components that have been looked up by name.
+    //! m_componentIndex[n] maps component names in reactor n to their
+    //! indices in the state vector. Cleared by initialize().
+    std::vector<std::map<std::string, size_t> > m_componentIndex;
+
     vector_fp m_atol;
     doublereal m_rtol, m_rtolsens;
     doublereal m_atols, m_atolsens;
     doublereal m_maxstep;
     int m_maxErrTestFails;
     bool m_verbose;
+    bool m_forwardSens; //!< Integrate the forward sensitivity equations
+    bool m_sensEquations; //!< Use evalSensitivities()
     size_t m_ntotpar;
     std::vector<size_t> m_nparams;
 
@@ -269,7 +632,67 @@ protected:
 
     vector_fp m_ydot;
 
+    //! An event added with addEvent()
+    struct Event {
+        size_t component; //!< index in the global state vector
+        double value; //!< value of the component at the event
+        int direction; //!< sign of the crossing, or 0 for either
+        int derivative; //!< order of the time derivative of the component
+    };
+
+    //! Evaluate the event functions at time *t* within the last internal
+    //! time step of the integrator, storing the results in *g*.
+    void evalEvents(double t, vector_fp& g);
+
+    //! Evaluate the event functions for the state vector *y* and its time
+    //! derivative *ydot*.
+    void evalEvents(const double* y, const double* ydot, vector_fp& g) const;
+
+    //! Find the time at which event function *i* changes sign in the
+    //! interval (*ta*, *tb*], where it has the value *ga* at *ta*. On input,
+    //! *g* contains the values of the event functions at *tb*, and on output
+    //! their values at the returned time.
+    double locateEvent(size_t i, double ta, double ga, double tb,
+                       vector_fp& g);
+
+    //! Record the end of each internal time step before *time*, which are
+    //! taken one at a time. Used by advance() when a recorder is set.
+    void recordSteps(double time);
+
+    ReactorRecorder* m_recorder;
+    vector_fp m_rec_y; //!< interpolated state used by recordSteps()
+
+    std::vector<Event> m_events;
+    size_t m_lastEvent; //!< index of the event found by advanceToEvent()
+    vector_fp m_event_g; //!< event functions at #m_event_t
+    double m_event_t; //!< time at which #m_event_g was evaluated
+    vector_fp m_event_y; //!< interpolated state used by evalEvents()
+    vector_fp m_event_ydot; //!< interpolated derivatives used by evalEvents()
+
+    //! @name Work arrays used by evalSensitivities()
+    //! @{
+    vector_fp m_sens_y; //!< state at which #m_sens_jac was evaluated
+    doublereal m_sens_t; //!< time at which #m_sens_jac was evaluated
+    vector_fp m_sens_ydot;
+    Array2D m_sens_jac; //!< Jacobian of the time derivatives
+    Array2D m_sens_dfdp; //!< derivatives with respect to the parameters
+    //! @}
+
     std::vector<bool> m_iown;
+
+    //! @name Work arrays and options used by solveSteady()
+    //! @{
+    vector_fp m_ss_y; //!< current estimate of the solution
+    vector_fp m_ss_yold; //!< solution at the last pseudo-time step
+    vector_fp m_ss_y1; //!< trial solution during damping
+    vector_fp m_ss_step; //!< undamped Newton step
+    vector_fp m_ss_step1; //!< Newton step at the trial solution
+    vector_fp m_ss_params; //!< unperturbed sensitivity parameters
+    DenseMatrix m_ss_jac; //!< Jacobian, then its LU factorization
+    doublereal m_ss_dt; //!< initial pseudo-time step
+    int m_ss_nsteps; //!< pseudo-time steps between Newton attempts
+    int m_ss_maxiter; //!< maximum Newton iterations per attempt
+    //! @}
 };
 }
 
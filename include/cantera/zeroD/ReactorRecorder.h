@@ -0,0 +1,170 @@
+/**
+ *  @file ReactorRecorder.h
+ *  Header file for class ReactorRecorder.
+ */
+
+#ifndef CT_REACTORRECORDER_H
+#define CT_REACTORRECORDER_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <fstream>
+#include <list>
+
+namespace Cantera
+{
+
+class Reactor;
+
+//! Records the time history of selected quantities of the reactors in a
+//! ReactorNet.
+/*!
+ *  The recorder is attached to a ReactorNet with ReactorNet::setRecorder(),
+ *  after which a row is recorded after each internal time step taken by
+ *  ReactorNet::advance(), ReactorNet::step() or ReactorNet::advanceToEvent(),
+ *  as well as at the output times of these methods. The first column is the
+ *  time, followed by the columns for each quantity added with add().
+ *
+ *  The data are stored in a single buffer in column-major order, so each
+ *  column is contiguous, with a leading dimension of capacity(). The buffer
+ *  grows geometrically as rows are recorded, or can be preallocated with
+ *  reserve(), so recording a row does not allocate any memory. Each row can
+ *  also be written to a binary file as it is recorded; see streamTo().
+ */
+class ReactorRecorder
+{
+public:
+    ReactorRecorder();
+    virtual ~ReactorRecorder();
+
+    //! Add columns for the quantity named *quantity* of the reactor *r*.
+    /*!
+     *  The recognized quantities are:
+     *  - `T`: temperature [K]
+     *  - `P`: pressure [Pa]
+     *  - `density`: density [kg/m^3]
+     *  - `volume`: volume [m^3]
+     *  - `mass`: mass [kg]
+     *  - `Y`: mass fractions of all species
+     *  - `X`: mole fractions of all species
+     *  - `net_production_rates`: net molar production rates of all species
+     *    from the homogeneous reactions [kmol/m^3/s]
+     *  - `heat_release_rate`: volumetric heat release rate from the
+     *    homogeneous reactions [W/m^3]
+     *
+     *  Quantities can only be added before any rows have been recorded.
+     *  @returns the index of the first column added
+     */
+    size_t add(Reactor& r, const std::string& quantity);
+
+    //! Number of columns, including the time.
+    size_t nColumns() const {
+        return m_names.size();
+    }
+
+    //! Number of rows recorded.
+    size_t nRows() const {
+        return m_nrows;
+    }
+
+    //! Number of rows which can be recorded without enlarging the buffer.
+    //! This is also the leading dimension of the buffer returned by data().
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+    //! Name of column *j*, e.g. `time` or `reactor1.Y_H2`.
+    const std::string& columnName(size_t j) const {
+        return m_names.at(j);
+    }
+
+    //! Index of the column named *name*, or npos if there is no such column.
+    size_t columnIndex(const std::string& name) const;
+
+    //! Pointer to the first of the nRows() values in column *j*.
+    const double* column(size_t j) const {
+        return data() + j * m_capacity;
+    }
+
+    //! Value in row *i* of column *j*.
+    double value(size_t i, size_t j) const {
+        return m_data[i + j * m_capacity];
+    }
+
+    //! Pointer to the start of the buffer. The value in row *i* of column
+    //! *j* is at `data()[i + j * capacity()]`.
+    const double* data() const {
+        return (m_data.empty()) ? 0 : &m_data[0];
+    }
+
+    double* data() {
+        return (m_data.empty()) ? 0 : &m_data[0];
+    }
+
+    //! Enlarge the buffer so that at least *nrows* rows can be stored.
+    void reserve(size_t nrows);
+
+    //! Remove all recorded rows, keeping the columns and the buffer.
+    void clear() {
+        m_nrows = 0;
+    }
+
+    //! Write each row to the file *filename* as it is recorded.
+    /*!
+     *  Each row is written as nColumns() native double precision values,
+     *  without any header. Rows which have already been recorded are not
+     *  written. An empty file name stops writing to the current file.
+     */
+    void streamTo(const std::string& filename);
+
+    //! Record a row for the current state of the reactors at time *t*.
+    void record(double t);
+
+    //! Called before the buffer is exported by reference, e.g. to a NumPy
+    //! array. While any exports are active, buffers which are replaced when
+    //! the buffer is enlarged are retained rather than deleted, so that the
+    //! exported data remain valid.
+    void addExport() {
+        m_nexports++;
+    }
+
+    //! Called when an export by addExport() is no longer in use.
+    void releaseExport();
+
+protected:
+    //! Quantities which can be recorded
+    enum Quantity {
+        Temperature, Pressure, Density, Volume, Mass, MassFractions,
+        MoleFractions, NetProductionRates, HeatReleaseRate
+    };
+
+    //! A quantity of a reactor added with add()
+    struct Entry {
+        Reactor* reactor;
+        Quantity quantity;
+        size_t start; //!< index of the first column
+    };
+
+    std::vector<Entry> m_entries;
+    std::vector<std::string> m_names; //!< column names
+    vector_fp m_data; //!< column-major buffer
+    size_t m_nrows;
+    size_t m_capacity;
+
+    //! Buffers replaced while exports were active
+    std::list<vector_fp> m_retired;
+    int m_nexports;
+
+    std::ofstream m_stream;
+    vector_fp m_row; //!< row written to #m_stream
+    vector_fp m_work; //!< work array used by record()
+    vector_fp m_work2; //!< work array used by record()
+
+private:
+    ReactorRecorder(const ReactorRecorder&);
+    ReactorRecorder& operator=(const ReactorRecorder&);
+};
+
+}
+
+#endif
@@ -92,10 +92,13 @@ public:
         return m_emiss;
     }
 
-    //! Set the wall velocity to a specified function of time
+    //! Set the wall velocity to a specified function of time. The function
+    //! is compiled when it is set, so changes to its structure made
+    //! afterwards have no effect.
     void setVelocity(Cantera::Func1* f=0) {
         if (f) {
             m_vf = f;
+            m_vfCode.compile(*f);
         }
     }
 
@@ -109,9 +112,16 @@ public:
         return m_k;
     }
 
-    //! Specify the heat flux function \f$ q_0(t) \f$.
+    //! Specify the heat flux function \f$ q_0(t) \f$. The function is
+    //! compiled when it is set, so changes to its structure made afterwards
+    //! have no effect.
     void setHeatFlux(Cantera::Func1* q) {
         m_qf = q;
+        if (q) {
+            m_qfCode.compile(*q);
+        } else {
+            m_qfCode.clear();
+        }
     }
 
     //! Install the wall between two reactors or reservoirs
@@ -189,6 +199,8 @@ protected:
     doublereal m_emiss;
     Cantera::Func1* m_vf;
     Cantera::Func1* m_qf;
+    Cantera::CompiledFunc1 m_vfCode; //!< compiled form of #m_vf
+    Cantera::CompiledFunc1 m_qfCode; //!< compiled form of #m_qf
     Cantera::vector_fp m_leftcov, m_rightcov;
 
     std::vector<size_t> m_pleft, m_pright;
@@ -35,7 +35,7 @@ public:
     /// need updating.
     virtual void updateMassFlowRate(doublereal time) {
         if (m_func) {
-            m_mdot = m_func->eval(time);
+            m_mdot = m_funcCode.eval(time);
         }
         m_mdot = std::max(m_mdot, 0.0);
     }
@@ -93,7 +93,7 @@ public:
     virtual void updateMassFlowRate(doublereal time) {
         double delta_P = in().pressure() - out().pressure();
         if (m_func) {
-            m_mdot = m_func->eval(delta_P);
+            m_mdot = m_funcCode.eval(delta_P);
         } else {
             m_mdot = m_coeffs[0]*delta_P;
         }
@@ -2,6 +2,8 @@
 #define CT_INCL_ZERODIM_H
 #include "zeroD/Reactor.h"
 #include "zeroD/ReactorNet.h"
+#include "zeroD/ReactorBatch.h"
+#include "zeroD/ReactorRecorder.h"
 #include "zeroD/Reservoir.h"
 #include "zeroD/Wall.h"
 #include "zeroD/flowControllers.h"
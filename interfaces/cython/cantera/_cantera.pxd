@@ -54,7 +54,7 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         double maxTemp() except +
         double refPressure() except +
         cbool getElementPotentials(double*) except +
-        void equilibrate(string, string, double, int, int, int, int) except +
+        void equilibrate(string, string, double, int, int, int, int) nogil except +translate_exception
 
         # basic thermodynamic properties
         double temperature() except +
@@ -83,6 +83,10 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         double molecularWeight(size_t) except +
         double meanMolecularWeight()
 
+        # state
+        void saveState(size_t, double*) except +
+        void restoreState(size_t, double*) except +
+
         # composition
         void setMassFractionsByName(string) except +
         void setMassFractionsByName(stdmap[string,double]&) except +
@@ -181,7 +185,7 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
 
 cdef extern from "cantera/kinetics/InterfaceKinetics.h":
     cdef cppclass CxxInterfaceKinetics "Cantera::InterfaceKinetics":
-        void advanceCoverages(double) except +
+        void advanceCoverages(double) nogil except +translate_exception
 
 
 cdef extern from "cantera/transport/TransportFactory.h":
@@ -213,7 +217,7 @@ cdef extern from "cantera/equil/MultiPhase.h" namespace "Cantera":
         void addPhase(CxxThermoPhase*, double) except +
         void init() except +
 
-        void equilibrate(string, string, double, int, int, int, int) except +
+        void equilibrate(string, string, double, int, int, int, int) nogil except +translate_exception
 
         size_t nSpecies()
         size_t nElements()
@@ -327,12 +331,39 @@ cdef extern from "cantera/zeroD/flowControllers.h":
         void setMaster(CxxFlowDevice*)
 
 
+cdef extern from "cantera/zeroD/ReactorRecorder.h":
+    cdef cppclass CxxReactorRecorder "Cantera::ReactorRecorder":
+        CxxReactorRecorder()
+        size_t add(CxxReactor&, string) except +
+        size_t nColumns()
+        size_t nRows()
+        size_t capacity()
+        string columnName(size_t) except +
+        size_t columnIndex(string)
+        double* data()
+        void reserve(size_t)
+        void clear()
+        void streamTo(string) except +
+        void record(double) except +
+        void addExport()
+        void releaseExport()
+
+
 cdef extern from "cantera/zeroD/ReactorNet.h":
     cdef cppclass CxxReactorNet "Cantera::ReactorNet":
         CxxReactorNet()
         void addReactor(CxxReactor&)
-        void advance(double) except +
-        double step(double) except +
+        void advance(double) nogil except +translate_exception
+        double step(double) nogil except +translate_exception
+        size_t addEvent(size_t, double, int, int) except +
+        void clearEvents()
+        size_t nEvents()
+        double advanceToEvent(double) nogil except +translate_exception
+        size_t lastEvent()
+        void setRecorder(CxxReactorRecorder*)
+        void getDenseOutput(double, int, double*) except +translate_exception
+        void solveSteady(int) nogil except +translate_exception
+        void setSteadyTimeStep(double, int)
         void reinitialize() except +
         double time()
         void setInitialTime(double)
@@ -348,9 +379,18 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         void setSensitivityTolerances(double, double)
         double rtolSensitivity()
         double atolSensitivity()
+        void setForwardSensitivities(cbool)
+        cbool forwardSensitivities()
+        void setAdjointCheckpointInterval(size_t) except +
+        size_t adjointCheckpointInterval()
+        void setIntegratorType(string) except +
+        string integratorType()
         double sensitivity(size_t, size_t) except +
         double sensitivity(string&, size_t, int) except +
-        size_t nparams()
+        void advanceAdjoint(double, vector[double]&, vector[double]&,
+                            vector[double]&) nogil except +translate_exception
+        size_t globalComponentIndex(string&, size_t) except +
+        size_t nSensParams()
         string sensitivityParameterName(size_t) except +
 
 
@@ -460,8 +500,8 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void showSolution() except +
         void setTimeStep(double, size_t, int*) except +
         void getInitialSoln() except +
-        void solve(int, cbool) except +translate_exception
-        void refine(int) except +
+        void solve(int, cbool) nogil except +translate_exception
+        void refine(int) nogil except +translate_exception
         void setRefineCriteria(size_t, double, double, double, double) except +
         void save(string, string, string, int) except +
         void restore(string, string, int) except +
@@ -586,6 +626,43 @@ ctypedef void (*thermoMethod1d)(CxxThermoPhase*, double*) except +
 ctypedef void (*transportMethod1d)(CxxTransport*, double*) except +
 ctypedef void (*transportMethod2d)(CxxTransport*, size_t, double*) except +
 ctypedef void (*kineticsMethod1d)(CxxKinetics*, double*) except +
+ctypedef double (*thermoScalar)(CxxThermoPhase*) except +
+ctypedef double (*transportScalar)(CxxTransport*) except +
+
+cdef extern from "cantera/cython/wrappers.h":
+    # ThermoPhase and Transport scalar properties
+    cdef double thermo_pressure(CxxThermoPhase*) except +
+    cdef double thermo_meanMolecularWeight(CxxThermoPhase*) except +
+    cdef double thermo_enthalpy_mole(CxxThermoPhase*) except +
+    cdef double thermo_intEnergy_mole(CxxThermoPhase*) except +
+    cdef double thermo_entropy_mole(CxxThermoPhase*) except +
+    cdef double thermo_gibbs_mole(CxxThermoPhase*) except +
+    cdef double thermo_cp_mole(CxxThermoPhase*) except +
+    cdef double thermo_cv_mole(CxxThermoPhase*) except +
+    cdef double thermo_enthalpy_mass(CxxThermoPhase*) except +
+    cdef double thermo_intEnergy_mass(CxxThermoPhase*) except +
+    cdef double thermo_entropy_mass(CxxThermoPhase*) except +
+    cdef double thermo_gibbs_mass(CxxThermoPhase*) except +
+    cdef double thermo_cp_mass(CxxThermoPhase*) except +
+    cdef double thermo_cv_mass(CxxThermoPhase*) except +
+    cdef double tran_viscosity(CxxTransport*) except +
+    cdef double tran_thermalConductivity(CxxTransport*) except +
+
+    # Evaluation of properties for a sequence of states
+    cdef void thermo_getArray_n(thermoMethod1d, CxxThermoPhase*, size_t,
+                                double*, size_t, double*) nogil except +
+    cdef void kin_getArray_n(kineticsMethod1d, CxxThermoPhase*, CxxKinetics*,
+                             size_t, double*, size_t, double*) nogil except +
+    cdef void tran_getArray_n(transportMethod1d, CxxThermoPhase*,
+                              CxxTransport*, size_t, double*, size_t,
+                              double*) nogil except +
+    cdef void thermo_getScalar_n(thermoScalar, CxxThermoPhase*, size_t,
+                                 double*, double*) nogil except +
+    cdef void tran_getScalar_n(transportScalar, CxxThermoPhase*,
+                               CxxTransport*, size_t, double*,
+                               double*) nogil except +
+    cdef void thermo_setState_TPC_n(CxxThermoPhase*, size_t, double*, double*,
+                                    double*, cbool, double*) nogil except +
 
 # classes
 cdef class _SolutionBase:
@@ -619,6 +696,16 @@ cdef class Transport(_SolutionBase):
 cdef class DustyGasTransport(Transport):
      pass
 
+cdef class SolutionArray:
+    cdef _SolutionBase phase
+    cdef np.ndarray _states
+    cdef size_t _n_species
+    cdef np.ndarray _thermoScalar(self, thermoScalar method)
+    cdef np.ndarray _thermoArray(self, thermoMethod1d method)
+    cdef np.ndarray _kineticsArray(self, kineticsMethod1d method, size_t dim)
+    cdef np.ndarray _transportScalar(self, transportScalar method)
+    cdef np.ndarray _transportArray(self, transportMethod1d method)
+
 cdef class Mixture:
     cdef CxxMultiPhase* mix
     cdef list _phases
@@ -687,9 +774,14 @@ cdef class Valve(FlowDevice):
 cdef class PressureController(FlowDevice):
     pass
 
+cdef class ReactorRecorder:
+    cdef CxxReactorRecorder* recorder
+    cdef list _reactors
+
 cdef class ReactorNet:
     cdef CxxReactorNet net
     cdef list _reactors
+    cdef ReactorRecorder _recorder
 
 cdef class Domain1D:
     cdef CxxDomain1D* domain
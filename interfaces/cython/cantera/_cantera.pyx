@@ -6,6 +6,7 @@ cimport numpy as np
 import math
 
 from cython.operator cimport dereference as deref, preincrement as inc
+from libc.stdlib cimport malloc, free
 
 from _cantera cimport *
 
@@ -18,6 +19,7 @@ include "thermo.pyx"
 include "kinetics.pyx"
 include "transport.pyx"
 include "composite.pyx"
+include "solutionarray.pyx"
 
 include "mixture.pyx"
 include "reactor.pyx"
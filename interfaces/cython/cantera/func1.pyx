@@ -1,11 +1,12 @@
 import sys
 
-cdef double func_callback(double t, void* obj, void** err):
+cdef double func_callback(double t, void* obj, void** err) with gil:
     """
     This function is called from C/C++ to evaluate a `Func1` object *obj*,
     returning the value of the function at *t*. If an exception occurs while
     evaluating the function, the Python exception info is saved in the
-    two-element array *err*.
+    two-element array *err*. The GIL is acquired if the calling code has
+    released it.
     """
     try:
         return (<Func1>obj).callable(t)
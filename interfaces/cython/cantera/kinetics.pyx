@@ -328,7 +328,9 @@ cdef class InterfaceKinetics(Kinetics):
         This method carries out a time-accurate advancement of the surface
         coverages for a specified amount of time.
         """
-        (<CxxInterfaceKinetics*>self.kinetics).advanceCoverages(dt)
+        cdef CxxInterfaceKinetics* kin = <CxxInterfaceKinetics*>self.kinetics
+        with nogil:
+            kin.advanceCoverages(dt)
 
     def phase_index(self, phase):
         """
@@ -328,5 +328,14 @@ cdef class Mixture:
                 raise ValueError('Unrecognized equilibrium solver '
                                  'specified: "{0}"'.format(solver))
 
-        self.mix.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                             max_steps, max_iter, estimate_equil, log_level)
+        cdef string cxx_XY = stringify(XY.upper())
+        cdef string cxx_solver = stringify(solver)
+        cdef double cxx_rtol = rtol
+        cdef int cxx_max_steps = max_steps
+        cdef int cxx_max_iter = max_iter
+        cdef int cxx_estimate_equil = estimate_equil
+        cdef int cxx_log_level = log_level
+        with nogil:
+            self.mix.equilibrate(cxx_XY, cxx_solver, cxx_rtol, cxx_max_steps,
+                                 cxx_max_iter, cxx_estimate_equil,
+                                 cxx_log_level)
@@ -676,14 +676,19 @@ cdef class Sim1D:
         """
         if not self._initialized:
             self.set_initial_guess()
-        self.sim.solve(loglevel, <cbool>refine_grid)
+        cdef int cxx_loglevel = loglevel
+        cdef cbool cxx_refine = refine_grid
+        with nogil:
+            self.sim.solve(cxx_loglevel, cxx_refine)
 
     def refine(self, loglevel=1):
         """
         Refine the grid, adding points where solution is not adequately
         resolved.
         """
-        self.sim.refine(loglevel)
+        cdef int cxx_loglevel = loglevel
+        with nogil:
+            self.sim.refine(cxx_loglevel)
 
     def set_refine_criteria(self, domain, ratio=10.0, slope=0.8, curve=0.8,
                           prune=0.05):
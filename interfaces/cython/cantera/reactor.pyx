@@ -728,6 +728,146 @@ cdef class PressureController(FlowDevice):
         (<CxxPressureController*>self.dev).setMaster(d.dev)
 
 
+cdef class ReactorRecorder:
+    """
+    Records the time history of selected quantities of the reactors in a
+    `ReactorNet`. Once the recorder is assigned to `ReactorNet.recorder`, a
+    row is recorded after each internal time step taken by the integrator
+    while advancing the network, and at each output time. The first column is
+    the time, followed by the columns for each quantity added with `add`.
+
+    The data are stored in a native buffer which is enlarged as needed, so
+    recording does not involve any Python objects. They are available without
+    copying as a NumPy array through `data`, or by calling
+    ``numpy.asarray(recorder)``::
+
+        >>> rec = ReactorRecorder()
+        >>> rec.add(r, 'T', 'Y', 'heat_release_rate')
+        >>> net.recorder = rec
+        >>> net.advance(1.0)
+        >>> plt.plot(rec['time'], rec[r.name + '.T'])
+
+    The arrays share memory with the recorder, so they show any rows which are
+    overwritten after a call to `clear`. They remain valid when more rows are
+    recorded, but do not include the new rows.
+    """
+    def __cinit__(self, *args, **kwargs):
+        self.recorder = new CxxReactorRecorder()
+
+    def __init__(self):
+        self._reactors = []
+
+    def __dealloc__(self):
+        del self.recorder
+
+    def add(self, Reactor r, *quantities):
+        """
+        Add columns for each of the *quantities* of the reactor *r*. The
+        recognized quantities are:
+
+          - ``'T'``: temperature [K]
+          - ``'P'``: pressure [Pa]
+          - ``'density'``: density [kg/m^3]
+          - ``'volume'``: volume [m^3]
+          - ``'mass'``: mass [kg]
+          - ``'Y'``: mass fractions of all species
+          - ``'X'``: mole fractions of all species
+          - ``'net_production_rates'``: net molar production rates of all
+            species from the homogeneous reactions [kmol/m^3/s]
+          - ``'heat_release_rate'``: volumetric heat release rate from the
+            homogeneous reactions [W/m^3]
+
+        The columns are named after the reactor and the quantity, e.g.
+        ``'Reactor_1.T'`` or ``'Reactor_1.Y_H2'``. Quantities can only be
+        added before any rows have been recorded.
+        """
+        self._reactors.append(r)
+        for q in quantities:
+            self.recorder.add(deref(r.reactor), stringify(q))
+
+    property n_columns:
+        """ Number of columns, including the time. """
+        def __get__(self):
+            return self.recorder.nColumns()
+
+    property n_rows:
+        """ Number of rows recorded. """
+        def __get__(self):
+            return self.recorder.nRows()
+
+    property column_names:
+        """ Names of all of the columns. """
+        def __get__(self):
+            return [pystr(self.recorder.columnName(j))
+                    for j in range(self.recorder.nColumns())]
+
+    def column_index(self, name):
+        """ Index of the column named *name*. """
+        cdef size_t j = self.recorder.columnIndex(stringify(name))
+        if j == CxxNpos:
+            raise KeyError(name)
+        return j
+
+    def __getitem__(self, name):
+        """ The recorded values in the column named *name*. """
+        return self.data[:, self.column_index(name)]
+
+    property data:
+        """
+        The recorded data as an array with dimensions *(n_rows, n_columns)*
+        which shares memory with the recorder.
+        """
+        def __get__(self):
+            return np.asarray(self)
+
+    def reserve(self, n):
+        """
+        Allocate space for at least *n* rows, so that the buffer does not need
+        to be enlarged while recording.
+        """
+        self.recorder.reserve(n)
+
+    def clear(self):
+        """ Remove all recorded rows. """
+        self.recorder.clear()
+
+    def stream_to(self, filename):
+        """
+        Write each row to the file *filename* as it is recorded, as
+        `n_columns` native double precision values without a header. The file
+        can be read with ``numpy.fromfile(filename).reshape(-1, n_columns)``.
+        Rows which have already been recorded are not written. If *filename*
+        is `None`, writing to the current file is stopped.
+        """
+        self.recorder.streamTo(stringify(filename or ''))
+
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        if not self.recorder.capacity():
+            self.recorder.reserve(1)
+        # shape and strides
+        cdef Py_ssize_t* dims = <Py_ssize_t*>malloc(4 * sizeof(Py_ssize_t))
+        dims[0] = self.recorder.nRows()
+        dims[1] = self.recorder.nColumns()
+        dims[2] = sizeof(double)
+        dims[3] = sizeof(double) * self.recorder.capacity()
+        buffer.buf = <void*>self.recorder.data()
+        buffer.format = 'd'
+        buffer.internal = dims
+        buffer.itemsize = sizeof(double)
+        buffer.len = dims[0] * dims[1] * sizeof(double)
+        buffer.ndim = 2
+        buffer.obj = self
+        buffer.readonly = 0
+        buffer.shape = dims
+        buffer.strides = dims + 2
+        buffer.suboffsets = NULL
+        self.recorder.addExport()
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        free(buffer.internal)
+        self.recorder.releaseExport()
+
+
 cdef class ReactorNet:
     """
     Networks of reactors. ReactorNet objects are used to simultaneously
@@ -757,14 +897,117 @@ cdef class ReactorNet:
         Advance the state of the reactor network in time from the current
         time to time *t* [s], taking as many integrator timesteps as necessary.
         """
-        self.net.advance(t)
+        with nogil:
+            self.net.advance(t)
 
     def step(self, double t):
         """
         Take a single internal time step toward time *t* [s]. The time after
         taking the step is returned.
         """
-        return self.net.step(t)
+        cdef double tnew
+        with nogil:
+            tnew = self.net.step(t)
+        return tnew
+
+    property recorder:
+        """
+        The `ReactorRecorder` which records the state of the reactors after
+        each time step, or `None`.
+        """
+        def __get__(self):
+            return self._recorder
+        def __set__(self, ReactorRecorder rec):
+            self._recorder = rec
+            self.net.setRecorder(rec.recorder if rec is not None else NULL)
+
+    def add_event(self, component, double value, int direction=0,
+                  derivative=False, int r=0):
+        """
+        Add an event at which `advance_to_event` stops the integration. The
+        event occurs when the solution component *component* (if *derivative*
+        is `False`) or its time derivative (if *derivative* is `True`) crosses
+        *value*. *component* is either the index of the component in the
+        global state vector, or its name in reactor *r*. If *direction* is
+        positive, only crossings where the component is increasing are
+        events; if it is negative, only those where it is decreasing. Returns
+        the index of the event. For example, to stop at the ignition point,
+        defined by a temperature threshold, and at the maximum mass fraction
+        of OH::
+
+            >>> net.add_event('temperature', 1500.0, direction=1)
+            >>> net.add_event('OH', 0.0, direction=-1, derivative=True)
+        """
+        cdef size_t k
+        if isinstance(component, (str, unicode)):
+            k = self.net.globalComponentIndex(stringify(component), r)
+        else:
+            k = component
+        return self.net.addEvent(k, value, direction, 1 if derivative else 0)
+
+    def clear_events(self):
+        """ Remove all of the events added with `add_event`. """
+        self.net.clearEvents()
+
+    property n_events:
+        """ Number of events added with `add_event`. """
+        def __get__(self):
+            return self.net.nEvents()
+
+    def advance_to_event(self, double t):
+        """
+        Advance the state of the reactor network from the current time to
+        time *t* [s], or until the first event added with `add_event`,
+        whichever comes first. The time of the event is found by interpolating
+        within the integrator time steps, so the reactors are left in the
+        state at the event without taking additional time steps. The time
+        reached is returned, and the event which occurred is given by
+        `last_event`. Calling this method again continues the integration
+        past the event.
+        """
+        cdef double tnew
+        with nogil:
+            tnew = self.net.advanceToEvent(t)
+        return tnew
+
+    property last_event:
+        """
+        Index of the event which stopped the last call to `advance_to_event`,
+        or `None` if no event occurred.
+        """
+        def __get__(self):
+            cdef size_t i = self.net.lastEvent()
+            return None if i == CxxNpos else i
+
+    def dense_output(self, double t, int k=0):
+        """
+        Interpolate the global state vector (if *k* = 0) or its *k*-th time
+        derivative at time *t* [s], which must be within the last internal
+        time step taken by the integrator. This gives the solution between
+        the times returned by `step` without further integration.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] data = np.empty(self.n_vars)
+        self.net.getDenseOutput(t, k, &data[0])
+        return data
+
+    def solve_steady(self, int loglevel=0):
+        """
+        Solve directly for the steady state of the reactor network using a
+        damped Newton method, falling back to pseudo-time stepping if the
+        Newton iteration fails. The network time is not changed. The network
+        must have an isolated steady state, e.g. each reactor is connected
+        (directly or indirectly) to a reservoir.
+        """
+        with nogil:
+            self.net.solveSteady(loglevel)
+
+    def set_steady_time_step(self, double dt, int nsteps):
+        """
+        Set the initial pseudo-time step *dt* [s] and the number of pseudo-time
+        steps *nsteps* taken by `solve_steady` each time the Newton iteration
+        fails.
+        """
+        self.net.setSteadyTimeStep(dt, nsteps)
 
     def reinitialize(self):
         """
@@ -839,6 +1082,43 @@ cdef class ReactorNet:
         def __set__(self, tol):
             self.net.setSensitivityTolerances(-1, tol)
 
+    property forward_sensitivities:
+        """
+        If *True* (the default), the sensitivities of all of the solution
+        variables with respect to each of the registered parameters are
+        integrated along with the solution. Setting this to *False* is useful
+        when the sensitivities are instead computed with `advance_adjoint`.
+        """
+        def __get__(self):
+            return pybool(self.net.forwardSensitivities())
+        def __set__(self, pybool v):
+            self.net.setForwardSensitivities(v)
+
+    property adjoint_checkpoint_interval:
+        """
+        The number of time steps between the checkpoints of the forward
+        solution stored by `advance_adjoint`. Smaller intervals use less
+        memory but recompute more of the forward solution. The default is 50.
+        """
+        def __get__(self):
+            return self.net.adjointCheckpointInterval()
+        def __set__(self, size_t n):
+            self.net.setAdjointCheckpointInterval(n)
+
+    property integrator_type:
+        """
+        The integrator used to integrate the network. The default is
+        ``'CVODE'``. The alternatives are ``'Rosenbrock'``, a linearly-implicit
+        method for stiff problems which is cheap to restart, and
+        ``'RungeKutta'``, an explicit method for non-stiff problems which
+        raises an exception if the problem is found to be stiff. Sensitivity
+        analysis requires ``'CVODE'``.
+        """
+        def __get__(self):
+            return pystr(self.net.integratorType())
+        def __set__(self, itype):
+            self.net.setIntegratorType(stringify(itype))
+
     property verbose:
         """
         If *True*, verbose debug information will be printed during
@@ -902,6 +1182,53 @@ cdef class ReactorNet:
                 data[k,p] = self.net.sensitivity(k,p)
         return data
 
+    def advance_adjoint(self, double t, final=None, integral=None, int r=0):
+        r"""
+        Advance the state of the reactor network to time *t* [s], and return
+        the sensitivities of a scalar output with respect to all of the
+        registered parameters, computed using the adjoint method. The output
+        is defined in terms of the vector of solution variables :math:`y`:
+
+        .. math:: G = a^T y(t) + \int_{t_0}^{t} b^T y \, dt
+
+        where :math:`t_0` is the current time. The weights :math:`a` and
+        :math:`b` are given by *final* and *integral*, respectively. Each is
+        either an array of length `n_vars`, or a dict mapping the names of
+        components of reactor *r* to their weights. For example, the
+        sensitivities of the final temperature of an `IdealGasReactor` are
+        given by::
+
+            >>> dTdp = net.advance_adjoint(t, final={'temperature': 1.0})
+
+        The cost of the calculation depends only weakly on the number of
+        parameters, so this is much faster than computing all of the
+        `sensitivities` when there are many parameters, in which case the
+        `forward_sensitivities` should be disabled. The derivatives are with
+        respect to the parameters (multipliers with a nominal value of 1) and
+        are not normalized by :math:`G`.
+        """
+        cdef vector[double] a = self._state_weights(final, r)
+        cdef vector[double] b = self._state_weights(integral, r)
+        cdef vector[double] dGdp
+        with nogil:
+            self.net.advanceAdjoint(t, a, b, dGdp)
+        return np.array(dGdp)
+
+    def _state_weights(self, weights, int r):
+        cdef vector[double] w
+        if weights is None:
+            return w
+        if isinstance(weights, dict):
+            index = [(self.net.globalComponentIndex(stringify(k), r), v)
+                     for k, v in weights.items()]
+            w.resize(self.net.neq(), 0.0)
+            for k, v in index:
+                w[k] = v
+        else:
+            for v in weights:
+                w.push_back(v)
+        return w
+
     def sensitivity_parameter_name(self, int p):
         """
         Name of the sensitivity parameter with index *p*.
@@ -913,7 +1240,7 @@ cdef class ReactorNet:
         The number of registered sensitivity parameters.
         """
         def __get__(self):
-            return self.net.nparams()
+            return self.net.nSensParams()
 
     property n_vars:
         """
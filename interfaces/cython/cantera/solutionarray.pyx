@@ -0,0 +1,405 @@
+cdef class SolutionArray:
+    """
+    A fixed number of states of a `ThermoPhase` or `Solution` object, whose
+    properties are evaluated for all of the states at once.
+
+    The states are stored as the rows of a 2D array, each containing the
+    temperature, the density and the mass fractions of the species. To
+    evaluate a property, the phase object is set to each of the states in
+    turn within a single compiled loop, which avoids the overhead of a
+    separate call from Python for each state. The state of the phase object
+    itself is not changed. Scalar properties are returned as 1D arrays with
+    one element per state, and species and reaction properties as 2D arrays
+    with one row per state::
+
+        >>> gas = ct.Solution('gri30.xml')
+        >>> states = ct.SolutionArray(gas, 1000)
+        >>> states.TPY = T, P, Y
+        >>> wdot = states.net_production_rates # shape (1000, gas.n_species)
+
+    :param phase:
+        The phase used to evaluate the properties. Kinetic and transport
+        properties are available if it is also a `Kinetics` or `Transport`
+        object.
+    :param n:
+        The number of states. Each state is initialized to the current state of
+        *phase*.
+    """
+    def __cinit__(self, _SolutionBase phase, n=0):
+        self.phase = phase
+        self._n_species = phase.thermo.nSpecies()
+        cdef np.ndarray[np.double_t, ndim=1] state = \
+                np.empty(self._n_species + 2)
+        phase.thermo.saveState(len(state), &state[0])
+        self._states = np.empty((n, self._n_species + 2))
+        self._states[:] = state
+
+    def __len__(self):
+        return len(self._states)
+
+    property n_states:
+        """Number of states."""
+        def __get__(self):
+            return len(self._states)
+
+    property states:
+        """
+        Get/Set the 2D array of states. Each row contains the temperature [K],
+        the density [kg/m^3] and the mass fractions of one state. Setting this
+        property can change the number of states.
+        """
+        def __get__(self):
+            return self._states
+        def __set__(self, values):
+            data = np.array(values, dtype=np.double, ndmin=2)
+            if data.shape[1] != <int>self._n_species + 2:
+                raise ValueError("Array has incorrect number of columns")
+            self._states = data
+
+    cdef np.ndarray _thermoScalar(self, thermoScalar method):
+        cdef np.ndarray[np.double_t, ndim=2] states = self._states
+        cdef size_t n = len(states)
+        cdef double* pstates
+        cdef double* pdata
+        cdef np.ndarray[np.double_t, ndim=1] data = np.empty(n)
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        if n:
+            pstates = &states[0,0]
+            pdata = &data[0]
+            with nogil:
+                thermo_getScalar_n(method, thermo, n, pstates, pdata)
+        return data
+
+    cdef np.ndarray _thermoArray(self, thermoMethod1d method):
+        cdef np.ndarray[np.double_t, ndim=2] states = self._states
+        cdef size_t n = len(states)
+        cdef double* pstates
+        cdef double* pdata
+        cdef np.ndarray[np.double_t, ndim=2] data = \
+                np.empty((n, self._n_species))
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        cdef size_t dim = self._n_species
+        if n:
+            pstates = &states[0,0]
+            pdata = &data[0,0]
+            with nogil:
+                thermo_getArray_n(method, thermo, n, pstates, dim, pdata)
+        return data
+
+    cdef np.ndarray _kineticsArray(self, kineticsMethod1d method, size_t dim):
+        if self.phase.kinetics is NULL:
+            raise TypeError('Phase does not have a kinetics manager')
+        cdef np.ndarray[np.double_t, ndim=2] states = self._states
+        cdef size_t n = len(states)
+        cdef double* pstates
+        cdef double* pdata
+        cdef np.ndarray[np.double_t, ndim=2] data = np.empty((n, dim))
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        cdef CxxKinetics* kin = self.phase.kinetics
+        if n and dim:
+            pstates = &states[0,0]
+            pdata = &data[0,0]
+            with nogil:
+                kin_getArray_n(method, thermo, kin, n, pstates, dim, pdata)
+        return data
+
+    cdef np.ndarray _transportScalar(self, transportScalar method):
+        if self.phase.transport is NULL:
+            raise TypeError('Phase does not have a transport manager')
+        cdef np.ndarray[np.double_t, ndim=2] states = self._states
+        cdef size_t n = len(states)
+        cdef double* pstates
+        cdef double* pdata
+        cdef np.ndarray[np.double_t, ndim=1] data = np.empty(n)
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        cdef CxxTransport* tran = self.phase.transport
+        if n:
+            pstates = &states[0,0]
+            pdata = &data[0]
+            with nogil:
+                tran_getScalar_n(method, thermo, tran, n, pstates, pdata)
+        return data
+
+    cdef np.ndarray _transportArray(self, transportMethod1d method):
+        if self.phase.transport is NULL:
+            raise TypeError('Phase does not have a transport manager')
+        cdef np.ndarray[np.double_t, ndim=2] states = self._states
+        cdef size_t n = len(states)
+        cdef double* pstates
+        cdef double* pdata
+        cdef np.ndarray[np.double_t, ndim=2] data = \
+                np.empty((n, self._n_species))
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        cdef CxxTransport* tran = self.phase.transport
+        cdef size_t dim = self._n_species
+        if n:
+            pstates = &states[0,0]
+            pdata = &data[0,0]
+            with nogil:
+                tran_getArray_n(method, thermo, tran, n, pstates, dim, pdata)
+        return data
+
+    def _composition(self, C, mole):
+        if isinstance(C, (str, unicode, dict)):
+            # Convert to an array using the phase object
+            T, D, Y = self.phase.TDY
+            if mole:
+                self.phase.X = C
+                C = self.phase.X
+            else:
+                self.phase.Y = C
+                C = self.phase.Y
+            self.phase.TDY = T, D, Y
+        return C
+
+    def _setTPC(self, T, P, C, mole):
+        C = self._composition(C, mole)
+        n = len(self._states)
+        cdef np.ndarray[np.double_t, ndim=1] TT = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=1] PP = np.empty(n)
+        cdef np.ndarray[np.double_t, ndim=2] CC = \
+                np.empty((n, self._n_species))
+        cdef np.ndarray[np.double_t, ndim=2] states = \
+                np.empty((n, self._n_species + 2))
+        cdef CxxThermoPhase* thermo = self.phase.thermo
+        cdef cbool cxx_mole = mole
+        cdef size_t nn = n
+        cdef double *pT, *pP, *pC, *pstates
+        TT[:] = T
+        PP[:] = P
+        CC[:] = C
+        if n:
+            pT = &TT[0]
+            pP = &PP[0]
+            pC = &CC[0,0]
+            pstates = &states[0,0]
+            with nogil:
+                thermo_setState_TPC_n(thermo, nn, pT, pP, pC, cxx_mole,
+                                      pstates)
+        self._states = states
+
+    property T:
+        """Temperature [K] of each state."""
+        def __get__(self):
+            return self._states[:,0]
+
+    property density_mass:
+        """Density [kg/m^3] of each state."""
+        def __get__(self):
+            return self._states[:,1]
+
+    property Y:
+        """Mass fractions of each state."""
+        def __get__(self):
+            return self._states[:,2:]
+
+    property P:
+        """Pressure [Pa] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_pressure)
+
+    property X:
+        """Mole fractions of each state."""
+        def __get__(self):
+            return self._thermoArray(thermo_getMoleFractions)
+
+    property TPY:
+        """
+        Set the temperature [K], pressure [Pa] and mass fractions of each
+        state. Each value may be given either for every state, or once for all
+        of the states. A single composition may also be given as a string or
+        a dictionary, as for `ThermoPhase.Y`.
+        """
+        def __set__(self, values):
+            assert len(values) == 3
+            self._setTPC(values[0], values[1], values[2], False)
+
+    property TPX:
+        """
+        Set the temperature [K], pressure [Pa] and mole fractions of each
+        state. Each value may be given either for every state, or once for all
+        of the states. A single composition may also be given as a string or
+        a dictionary, as for `ThermoPhase.X`.
+        """
+        def __set__(self, values):
+            assert len(values) == 3
+            self._setTPC(values[0], values[1], values[2], True)
+
+    property TDY:
+        """
+        Set the temperature [K], density [kg/m^3] and mass fractions of each
+        state. Each value may be given either for every state, or once for all
+        of the states. A single composition may also be given as a string or
+        a dictionary, as for `ThermoPhase.Y`.
+        """
+        def __set__(self, values):
+            assert len(values) == 3
+            states = np.empty((len(self._states), self._n_species + 2))
+            states[:,0] = values[0]
+            states[:,1] = values[1]
+            states[:,2:] = self._composition(values[2], False)
+            states[:,2:] /= np.sum(states[:,2:], axis=1)[:,np.newaxis]
+            self._states = states
+
+    property mean_molecular_weight:
+        """Mean molecular weight [kg/kmol] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_meanMolecularWeight)
+
+    property enthalpy_mole:
+        """Molar enthalpy [J/kmol] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_enthalpy_mole)
+
+    property enthalpy_mass:
+        """Specific enthalpy [J/kg] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_enthalpy_mass)
+
+    property int_energy_mole:
+        """Molar internal energy [J/kmol] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_intEnergy_mole)
+
+    property int_energy_mass:
+        """Specific internal energy [J/kg] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_intEnergy_mass)
+
+    property entropy_mole:
+        """Molar entropy [J/kmol/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_entropy_mole)
+
+    property entropy_mass:
+        """Specific entropy [J/kg/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_entropy_mass)
+
+    property gibbs_mole:
+        """Molar Gibbs free energy [J/kmol] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_gibbs_mole)
+
+    property gibbs_mass:
+        """Specific Gibbs free energy [J/kg] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_gibbs_mass)
+
+    property cp_mole:
+        """Molar heat capacity at constant pressure [J/kmol/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_cp_mole)
+
+    property cp_mass:
+        """Specific heat capacity at constant pressure [J/kg/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_cp_mass)
+
+    property cv_mole:
+        """Molar heat capacity at constant volume [J/kmol/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_cv_mole)
+
+    property cv_mass:
+        """Specific heat capacity at constant volume [J/kg/K] of each state."""
+        def __get__(self):
+            return self._thermoScalar(thermo_cv_mass)
+
+    property partial_molar_enthalpies:
+        """Species partial molar enthalpies [J/kmol] of each state."""
+        def __get__(self):
+            return self._thermoArray(thermo_getPartialMolarEnthalpies)
+
+    property partial_molar_cp:
+        """
+        Species partial molar specific heat capacities at constant pressure
+        [J/kmol/K] of each state.
+        """
+        def __get__(self):
+            return self._thermoArray(thermo_getPartialMolarCp)
+
+    property chemical_potentials:
+        """Species chemical potentials [J/kmol] of each state."""
+        def __get__(self):
+            return self._thermoArray(thermo_getChemPotentials)
+
+    property standard_enthalpies_RT:
+        """
+        Nondimensional species standard-state enthalpies of each state.
+        """
+        def __get__(self):
+            return self._thermoArray(thermo_getEnthalpy_RT)
+
+    property standard_cp_R:
+        """
+        Nondimensional species standard-state specific heat capacities at
+        constant pressure of each state.
+        """
+        def __get__(self):
+            return self._thermoArray(thermo_getCp_R)
+
+    property forward_rates_of_progress:
+        """Forward rates of progress of the reactions [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getFwdRatesOfProgress,
+                                       self._n_reactions())
+
+    property reverse_rates_of_progress:
+        """Reverse rates of progress of the reactions [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getRevRatesOfProgress,
+                                       self._n_reactions())
+
+    property net_rates_of_progress:
+        """Net rates of progress of the reactions [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getNetRatesOfProgress,
+                                       self._n_reactions())
+
+    property creation_rates:
+        """Species creation rates [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getCreationRates,
+                                       self._n_total_species())
+
+    property destruction_rates:
+        """Species destruction rates [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getDestructionRates,
+                                       self._n_total_species())
+
+    property net_production_rates:
+        """Species net production rates [kmol/m^3/s] for each state."""
+        def __get__(self):
+            return self._kineticsArray(kin_getNetProductionRates,
+                                       self._n_total_species())
+
+    property viscosity:
+        """Viscosity [Pa-s] of each state."""
+        def __get__(self):
+            return self._transportScalar(tran_viscosity)
+
+    property thermal_conductivity:
+        """Thermal conductivity [W/m/K] of each state."""
+        def __get__(self):
+            return self._transportScalar(tran_thermalConductivity)
+
+    property mix_diff_coeffs:
+        """
+        Mixture-averaged diffusion coefficients [m^2/s] relating the
+        mass-averaged diffusive fluxes (with respect to the mass averaged
+        velocity) to gradients in the species mole fractions, for each state.
+        """
+        def __get__(self):
+            return self._transportArray(tran_getMixDiffCoeffs)
+
+    def _n_reactions(self):
+        if self.phase.kinetics is NULL:
+            raise TypeError('Phase does not have a kinetics manager')
+        return self.phase.kinetics.nReactions()
+
+    def _n_total_species(self):
+        if self.phase.kinetics is NULL:
+            raise TypeError('Phase does not have a kinetics manager')
+        return self.phase.kinetics.nTotalSpecies()
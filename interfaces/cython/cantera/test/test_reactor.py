@@ -1,4 +1,5 @@
 import math
+import os
 import re
 
 import numpy as np
@@ -307,6 +308,15 @@ class TestReactor(utilities.CanteraTest):
         self.assertNear(U1a - Q, U1b, 1e-6)
         self.assertNear(U2a + Q, U2b, 1e-6)
 
+    def test_heat_flux_func_error(self):
+        self.make_reactors(T1=500, T2=300)
+        self.add_wall(A=0.3)
+        def heat_flux(t):
+            raise ValueError('spam')
+        self.w.set_heat_flux(heat_flux)
+        with self.assertRaises(ValueError):
+            self.net.advance(1.0)
+
     def test_mass_flow_controller(self):
         self.make_reactors(n_reactors=1)
         gas2 = ct.Solution('h2o2.xml')
@@ -503,6 +513,90 @@ class TestReactor(utilities.CanteraTest):
         self.assertNear(T1a, T1b)
         self.assertNear(T2a, T2b)
 
+    def test_reinitialize_tolerances(self):
+        # Changing the tolerances takes effect when the integrator memory is
+        # reused for a network of the same size
+        def count_steps(net, tEnd=1e-3):
+            n = 0
+            while net.time < tEnd:
+                net.step(tEnd)
+                n += 1
+            return n
+
+        X0 = 'H2:1.0, O2:0.5, AR:8.0'
+        self.make_reactors(n_reactors=1, T1=1100, X1=X0)
+        self.net.rtol = 1e-10
+        n_tight = count_steps(self.net)
+
+        self.make_reactors(n_reactors=1, T1=1100, X1=X0)
+        self.net.rtol = 1e-5
+        n_loose = count_steps(self.net)
+        T_loose = self.r1.T
+        self.assertTrue(n_tight > n_loose)
+
+        self.r1.thermo.TPX = 1100, ct.one_atm, X0
+        self.r1.syncState()
+        self.net.set_initial_time(0)
+        self.net.rtol = 1e-10
+        self.assertEqual(count_steps(self.net), n_tight)
+
+        self.r1.thermo.TPX = 1100, ct.one_atm, X0
+        self.r1.syncState()
+        self.net.set_initial_time(0)
+        self.net.rtol = 1e-5
+        self.assertEqual(count_steps(self.net), n_loose)
+        self.assertNear(self.r1.T, T_loose, 1e-12)
+
+    def test_rosenbrock_integrator(self):
+        X0 = 'H2:1.0, O2:0.5, AR:8.0'
+        self.make_reactors(n_reactors=1, T1=1100, X1=X0)
+        self.assertEqual(self.net.integrator_type, 'CVODE')
+        times = [1e-5, 1e-4, 3e-4, 1e-3]
+        T_ref = []
+        for t in times:
+            self.net.advance(t)
+            T_ref.append(self.r1.T)
+
+        self.make_reactors(n_reactors=1, T1=1100, X1=X0)
+        self.net.integrator_type = 'Rosenbrock'
+        self.assertEqual(self.net.integrator_type, 'Rosenbrock')
+        self.net.rtol = 1e-7
+        for t, T in zip(times, T_ref):
+            self.net.advance(t)
+            self.assertNear(self.r1.T, T, 1e-4)
+        self.assertTrue(self.r1.T > 2000)
+
+    def test_runge_kutta_integrator(self):
+        # Heat transfer without reactions is not stiff
+        self.make_reactors(T1=300, T2=1000)
+        self.add_wall(U=200, A=1.0)
+        self.net.advance(1.0)
+        T1, T2 = self.r1.T, self.r2.T
+
+        self.make_reactors(T1=300, T2=1000)
+        self.add_wall(U=200, A=1.0)
+        self.net.integrator_type = 'RungeKutta'
+        self.net.advance(1.0)
+        self.assertNear(self.r1.T, T1, 1e-6)
+        self.assertNear(self.r2.T, T2, 1e-6)
+
+        # Ignition is stiff
+        self.make_reactors(n_reactors=1, T1=1100, X1='H2:1.0, O2:0.5, AR:8.0')
+        self.net.integrator_type = 'RungeKutta'
+        with self.assertRaises(Exception):
+            self.net.advance(1e-3)
+
+    def test_integrator_type_errors(self):
+        self.make_reactors(n_reactors=1)
+        with self.assertRaises(Exception):
+            self.net.integrator_type = 'spam'
+        self.assertEqual(self.net.integrator_type, 'CVODE')
+
+        self.r1.add_sensitivity_reaction(2)
+        self.net.integrator_type = 'Rosenbrock'
+        with self.assertRaises(Exception):
+            self.net.advance(1e-4)
+
     def test_unpicklable(self):
         self.make_reactors()
         import pickle
@@ -537,6 +631,38 @@ class TestIdealGasReactor(TestReactor):
     reactorClass = ct.IdealGasReactor
 
 
+class TestReactorThreads(utilities.CanteraTest):
+    def make_network(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1100, ct.one_atm, 'H2:2, O2:1, AR:4'
+        env = ct.Reservoir(ct.Solution('h2o2.xml'))
+        r = ct.IdealGasReactor(gas)
+        w = ct.Wall(r, env, A=1.0)
+        w.set_heat_flux(lambda t: 1e5 * t)
+        net = ct.ReactorNet([r])
+        # keep references to all of the objects
+        return net, r, w, env
+
+    def test_concurrent(self):
+        # Independent networks can be integrated concurrently from separate
+        # threads, since ReactorNet.advance releases the GIL
+        import threading
+        networks = [self.make_network() for i in range(4)]
+        threads = [threading.Thread(target=n[0].advance, args=(0.01,))
+                   for n in networks]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        ref = self.make_network()
+        ref[0].advance(0.01)
+        for n in networks:
+            self.assertNear(n[0].time, 0.01)
+            self.assertNear(n[1].T, ref[1].T)
+            self.assertArrayNear(n[1].thermo.Y, ref[1].thermo.Y)
+
+
 class TestWellStirredReactorIgnition(utilities.CanteraTest):
     """ Ignition (or not) of a well-stirred reactor """
     def setup(self, T0, P0, mdot_fuel, mdot_ox):
@@ -964,6 +1090,37 @@ class TestReactorSensitivities(utilities.CanteraTest):
             self.assertNear(np.linalg.norm(S[Ns:K2,1]), 0.0, atol=1e-5)
             self.assertNear(np.linalg.norm(S[K2+Ns:,0]), 0.0, atol=1e-5)
 
+    def test_adjoint_consistency(self):
+        # Forward and adjoint sensitivities of the final temperature
+        params = [2, 5, 9, 19]
+        def setup():
+            gas = ct.Solution('h2o2.xml')
+            gas.TPX = 1000, 101325, 'H2:2, O2:1, AR:5'
+            r = ct.IdealGasReactor(gas)
+            net = ct.ReactorNet([r])
+            for i in params:
+                r.add_sensitivity_reaction(i)
+            net.rtol_sensitivity = 1e-6
+            net.atol_sensitivity = 1e-6
+            return r, net
+
+        r1, net1 = setup()
+        net1.advance(2e-4)
+        dTdp1 = [r1.T * net1.sensitivity('temperature', i)
+                 for i in range(len(params))]
+
+        r2, net2 = setup()
+        net2.forward_sensitivities = False
+        dTdp2 = net2.advance_adjoint(2e-4, {'temperature': 1.0})
+        self.assertArrayNear(dTdp1, dTdp2, 1e-3, 1e-3 * max(abs(dTdp2)))
+
+        # Recomputing the forward solution from closely spaced checkpoints
+        r3, net3 = setup()
+        net3.forward_sensitivities = False
+        net3.adjoint_checkpoint_interval = 5
+        dTdp3 = net3.advance_adjoint(2e-4, {'temperature': 1.0})
+        self.assertArrayNear(dTdp1, dTdp3, 1e-2, 1e-2 * max(abs(dTdp3)))
+
     def _test_parameter_order1(self, reactorClass):
         # Single reactor, changing the order in which parameters are added
         gas = ct.Solution('h2o2.xml')
@@ -1145,6 +1302,257 @@ class TestReactorSensitivities(utilities.CanteraTest):
                 self.assertArrayNear(S[a][:,i], S[b][:,j], 1e-2, 1e-3)
 
 
+class TestAdjointSensitivities(utilities.CanteraTest):
+    def setup(self, reactorClass, params, perturb=None):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1000, 101325, 'H2:2, O2:1, AR:5'
+        if perturb:
+            self.gas.set_multiplier(perturb[1], perturb[0])
+        r = reactorClass(self.gas)
+        net = ct.ReactorNet([r])
+        for i in params:
+            r.add_sensitivity_reaction(i)
+        net.forward_sensitivities = False
+        net.rtol_sensitivity = 1e-6
+        net.atol_sensitivity = 1e-6
+        return r, net
+
+    def check_finite_difference(self, reactorClass, tf, final, integral,
+                                output):
+        params = [0, 2, 5, 9, 14, 19]
+        r, net = self.setup(reactorClass, params)
+        dGdp = net.advance_adjoint(tf, final, integral)
+        self.assertEqual(dGdp.shape, (len(params),))
+
+        dp = 1e-3
+        for i, p in enumerate(params):
+            G = []
+            for mult in (1 - dp, 1 + dp):
+                r, net = self.setup(reactorClass, [], (p, mult))
+                G.append(output(r, net))
+            self.assertNear(dGdp[i], (G[1] - G[0]) / (2 * dp),
+                            rtol=5e-3, atol=1e-3 * max(abs(dGdp)))
+
+    def test_final_temperature(self):
+        tf = 2e-4
+        def output(r, net):
+            net.advance(tf)
+            return r.T
+        self.check_finite_difference(ct.IdealGasReactor, tf,
+                                     {'temperature': 1.0}, None, output)
+
+    def test_species_integral(self):
+        tf = 2e-4
+        def output(r, net):
+            # Integrate the mass fraction of H2O2 using the trapezoid rule
+            G = 0.0
+            Y0 = r.thermo['H2O2'].Y[0]
+            for t in np.linspace(0, tf, 1001)[1:]:
+                t0 = net.time
+                net.advance(t)
+                Y1 = r.thermo['H2O2'].Y[0]
+                G += 0.5 * (Y0 + Y1) * (t - t0)
+                Y0 = Y1
+            return G
+        self.check_finite_difference(ct.IdealGasConstPressureReactor, tf,
+                                     None, {'H2O2': 1.0}, output)
+
+    def test_array_weights(self):
+        r1, net1 = self.setup(ct.IdealGasReactor, [2, 9])
+        dGdp1 = net1.advance_adjoint(1e-4, {'OH': 2.0, 'temperature': 1.0})
+
+        r2, net2 = self.setup(ct.IdealGasReactor, [2, 9])
+        a = np.zeros(r2.component_index('AR') + 1)
+        a[r2.component_index('OH')] = 2.0
+        a[r2.component_index('temperature')] = 1.0
+        dGdp2 = net2.advance_adjoint(1e-4, a)
+        self.assertArrayNear(dGdp1, dGdp2)
+        self.assertNear(net1.time, 1e-4)
+        self.assertNear(r1.T, r2.T)
+
+        # Forward sensitivities were not computed
+        with self.assertRaises(Exception):
+            net1.sensitivities()
+        self.assertEqual(net1.n_sensitivity_params, 2)
+
+        with self.assertRaises(Exception):
+            net2.advance_adjoint(2e-4, [1.0, 2.0])
+
+
+class TestReactorEvents(utilities.CanteraTest):
+    def setup(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1001, 101325, 'H2:2, O2:1, AR:4'
+        self.r = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r])
+
+    def test_temperature_threshold(self):
+        self.setup()
+        self.assertEqual(self.net.add_event('temperature', 1500.0), 0)
+        t = self.net.advance_to_event(1.0)
+        self.assertEqual(self.net.last_event, 0)
+        self.assertNear(self.net.time, t)
+        self.assertNear(self.r.T, 1500.0, 1e-8)
+
+        # Compare with integrating to times just before and after the event
+        for dt, sign in ((-1e-5, -1), (1e-5, 1)):
+            self.setup()
+            self.net.advance(t * (1 + dt))
+            self.assertEqual(np.sign(self.r.T - 1500.0), sign)
+
+    def test_species_maximum(self):
+        self.setup()
+        kOH = self.r.component_index('OH')
+        self.net.add_event('temperature', 1200.0)
+        self.net.add_event(kOH, 0.0, direction=-1, derivative=True)
+
+        t1 = self.net.advance_to_event(1.0)
+        self.assertEqual(self.net.last_event, 0)
+        t2 = self.net.advance_to_event(1.0)
+        self.assertEqual(self.net.last_event, 1)
+        self.assertTrue(t2 > t1)
+        kT = self.r.component_index('temperature')
+        self.assertNear(self.r.T, self.net.dense_output(t2)[kT], 1e-8)
+        Ymax = self.r.thermo['OH'].Y[0]
+        dYdt = self.net.dense_output(t2, 1)[kOH]
+        self.assertTrue(abs(dYdt) < 1e-8 * Ymax / t2)
+
+        # Maximum found by taking many small steps
+        self.setup()
+        Yref = 0.0
+        for t in np.linspace(0.95 * t2, 1.05 * t2, 201):
+            self.net.advance(t)
+            Yref = max(Yref, self.r.thermo['OH'].Y[0])
+        self.assertTrue(Ymax >= Yref * (1 - 1e-6))
+        self.assertNear(Ymax, Yref, 1e-5)
+
+    def test_continue_after_event(self):
+        self.setup()
+        self.net.add_event('temperature', 1500.0, direction=-1)
+        self.net.add_event('temperature', 1500.0, direction=1)
+        self.assertEqual(self.net.n_events, 2)
+        self.net.advance_to_event(1e-3)
+        self.assertEqual(self.net.last_event, 1)
+
+        t = self.net.advance_to_event(1e-3)
+        self.assertEqual(self.net.last_event, None)
+        self.assertNear(t, 1e-3)
+        self.assertNear(self.net.time, 1e-3)
+
+        self.net.clear_events()
+        self.assertEqual(self.net.n_events, 0)
+        self.assertNear(self.net.advance_to_event(2e-3), 2e-3)
+
+    def test_dense_output(self):
+        self.setup()
+        t0 = self.net.step(1.0)
+        t1 = self.net.step(1.0)
+        kT = self.r.component_index('temperature')
+        y1 = self.net.dense_output(t1)
+        self.assertNear(y1[kT], self.r.T)
+        tm = 0.5 * (t0 + t1)
+        ym = self.net.dense_output(tm)
+
+        self.setup()
+        self.net.advance(tm)
+        self.assertNear(ym[kT], self.r.T, 1e-7)
+        self.assertArrayNear(ym[3:], self.r.thermo.Y, 1e-5, 1e-14)
+
+        with self.assertRaises(Exception):
+            self.net.dense_output(t1 + 10 * (t1 - t0))
+
+
+class TestReactorRecorder(utilities.CanteraTest):
+    def setup(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1001, 101325, 'H2:2, O2:1, AR:4'
+        self.r = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r])
+
+    def test_record_steps(self):
+        self.setup()
+        rec = ct.ReactorRecorder()
+        rec.add(self.r, 'T', 'P')
+        rec.add(self.r, 'Y')
+        self.assertEqual(rec.n_columns, 3 + self.gas.n_species)
+        self.assertEqual(rec.column_names[:3],
+                         ['time', self.r.name + '.T', self.r.name + '.P'])
+        self.net.recorder = rec
+        self.net.advance(1e-3)
+        self.assertEqual(rec.data.shape, (rec.n_rows, rec.n_columns))
+        self.assertNear(rec['time'][-1], 1e-3)
+        self.assertNear(rec[self.r.name + '.T'][-1], self.r.T)
+        self.assertArrayNear(rec.data[-1, 3:], self.r.thermo.Y)
+
+        # Compare with taking individual steps
+        self.setup()
+        times = [0.0]
+        T = [self.r.T]
+        while self.net.time < 1e-3:
+            times.append(self.net.step(1e-3))
+            T.append(self.r.T)
+        self.assertEqual(rec.n_rows, len(times))
+        self.assertArrayNear(rec['time'][:-1], times[:-1], 1e-12)
+        self.assertArrayNear(rec[self.r.name + '.T'][:-1], T[:-1], 1e-8)
+
+    def test_rates(self):
+        self.setup()
+        rec = ct.ReactorRecorder()
+        rec.add(self.r, 'net_production_rates', 'heat_release_rate', 'X')
+        self.net.recorder = rec
+        self.net.advance_to_event(1e-3)
+        self.net.step(1e-3)
+
+        wdot = rec.data[-1, 1:1+self.gas.n_species]
+        self.assertArrayNear(wdot, self.gas.net_production_rates)
+        hrr = -np.dot(self.gas.partial_molar_enthalpies, wdot)
+        self.assertNear(rec[self.r.name + '.heat_release_rate'][-1], hrr)
+        self.assertArrayNear(rec.data[-1, -self.gas.n_species:], self.gas.X)
+        self.assertTrue(max(rec[self.r.name + '.heat_release_rate']) > 0)
+
+    def test_buffer(self):
+        self.setup()
+        rec = ct.ReactorRecorder()
+        rec.add(self.r, 'T')
+        rec.reserve(5)
+        self.net.recorder = rec
+        for i in range(3):
+            self.net.step(1.0)
+        data = rec.data
+        self.assertEqual(data.shape, (4, 2))
+        first = data.copy()
+
+        # The array remains valid after the buffer is enlarged
+        self.net.advance(1e-3)
+        self.assertTrue(rec.n_rows > 10)
+        self.assertArrayNear(data, first)
+        self.assertArrayNear(rec.data[:4], first)
+
+        with self.assertRaises(Exception):
+            rec.add(self.r, 'P')
+        with self.assertRaises(KeyError):
+            rec['spam']
+
+        rec.clear()
+        self.assertEqual(rec.n_rows, 0)
+        self.net.recorder = None
+        self.net.advance(2e-3)
+        self.assertEqual(rec.n_rows, 0)
+
+    def test_stream_to_file(self):
+        self.setup()
+        filename = 'reactor-recorder.bin'
+        rec = ct.ReactorRecorder()
+        rec.add(self.r, 'T', 'Y')
+        rec.stream_to(filename)
+        self.net.recorder = rec
+        self.net.advance(1e-4)
+        rec.stream_to(None)
+        data = np.fromfile(filename).reshape(-1, rec.n_columns)
+        self.assertArrayNear(data, rec.data)
+        os.remove(filename)
+
+
 class CombustorTestImplementation(object):
     """
     These tests are based on the sample:
@@ -1232,6 +1640,19 @@ class CombustorTestImplementation(object):
                                             rtol=1e-6, atol=1e-12)
             self.assertFalse(bad, bad)
 
+    def test_solve_steady(self):
+        # ignite, then jump directly to the steady state
+        self.sim.advance(0.25)
+        self.sim.solve_steady()
+        self.assertNear(self.sim.time, 0.25)
+        T = self.combustor.T
+        X = self.combustor.thermo.X
+
+        # the steady state is unchanged by further integration
+        self.sim.advance(2.0)
+        self.assertNear(self.combustor.T, T, 1e-5)
+        self.assertArrayNear(self.combustor.thermo.X, X, 1e-5, 1e-9)
+
 
 class WallTestImplementation(object):
     """
@@ -624,3 +624,74 @@ ideal_gas(name='spam', elements='O H',
     def test_checkReactionBalance(self):
         with self.assertRaises(Exception):
             ct.Solution('../data/h2o2_unbalancedReaction.xml')
+
+
+class TestSolutionArray(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 900, 2e5, 'H2:1.0, O2:0.4, AR:3, H2O:0.1'
+        self.T = np.linspace(800, 2000, 7)
+        self.P = np.linspace(1e5, 7e5, 7)
+        self.X = np.random.random((7, self.gas.n_species))
+        self.states = ct.SolutionArray(self.gas, 7)
+        self.states.TPX = self.T, self.P, self.X
+
+    def test_initial_state(self):
+        states = ct.SolutionArray(self.gas, 3)
+        self.assertEqual(len(states), 3)
+        for i in range(3):
+            self.assertNear(states.T[i], self.gas.T)
+            self.assertNear(states.density_mass[i], self.gas.density_mass)
+            self.assertArrayNear(states.Y[i], self.gas.Y)
+
+    def test_properties(self):
+        T, P, X = self.gas.TPX
+        n = self.gas.n_species
+        self.assertEqual(self.states.net_production_rates.shape, (7, n))
+        self.assertEqual(self.states.net_rates_of_progress.shape,
+                         (7, self.gas.n_reactions))
+        for i in range(7):
+            self.gas.TPX = self.T[i], self.P[i], self.X[i]
+            self.assertNear(self.states.P[i], self.gas.P)
+            self.assertArrayNear(self.states.X[i], self.gas.X)
+            self.assertNear(self.states.enthalpy_mass[i], self.gas.enthalpy_mass)
+            self.assertNear(self.states.cp_mole[i], self.gas.cp_mole)
+            self.assertArrayNear(self.states.partial_molar_enthalpies[i],
+                                 self.gas.partial_molar_enthalpies)
+            self.assertArrayNear(self.states.net_production_rates[i],
+                                 self.gas.net_production_rates)
+            self.assertArrayNear(self.states.forward_rates_of_progress[i],
+                                 self.gas.forward_rates_of_progress)
+            self.assertNear(self.states.viscosity[i], self.gas.viscosity)
+            self.assertArrayNear(self.states.mix_diff_coeffs[i],
+                                 self.gas.mix_diff_coeffs)
+
+        # The state of the phase is not changed
+        self.gas.TPX = T, P, X
+        self.states.net_production_rates
+        self.assertNear(self.gas.T, T)
+        self.assertNear(self.gas.P, P)
+        self.assertArrayNear(self.gas.X, X)
+
+    def test_set_TDY(self):
+        states = ct.SolutionArray(self.gas, 7)
+        states.TDY = self.states.T, self.states.density_mass, self.states.Y
+        self.assertArrayNear(states.P, self.P)
+        states.TDY = 1000, 0.5, 'H2:1'
+        self.assertArrayNear(states.T, 1000 * np.ones(7))
+
+    def test_set_states(self):
+        states = ct.SolutionArray(self.gas)
+        self.assertEqual(len(states), 0)
+        states.states = self.states.states[2:5]
+        self.assertEqual(len(states), 3)
+        self.assertArrayNear(states.P, self.P[2:5])
+        with self.assertRaises(ValueError):
+            states.states = np.ones((3, 4))
+
+    def test_no_kinetics(self):
+        states = ct.SolutionArray(ct.ThermoPhase('h2o2.xml'), 2)
+        with self.assertRaises(TypeError):
+            states.net_production_rates
+        with self.assertRaises(TypeError):
+            states.viscosity
@@ -155,8 +155,11 @@ cdef class ThermoPhase(_SolutionBase):
                 raise ValueError('Invalid equilibrium solver specified: '
                     '"{0}"'.format(solver))
 
-        self.thermo.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                                maxsteps, maxiter, estimate_equil, loglevel)
+        cdef string cxx_XY = stringify(XY.upper())
+        cdef string cxx_solver = stringify(solver)
+        with nogil:
+            self.thermo.equilibrate(cxx_XY, cxx_solver, rtol, maxsteps,
+                                    maxiter, estimate_equil, loglevel)
 
     ####### Composition, species, and elements ########
 
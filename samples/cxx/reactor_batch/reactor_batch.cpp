@@ -0,0 +1,84 @@
+// Benchmark for integrating many independent reactors with ReactorBatch, as
+// in the chemistry step of an operator-split reacting flow simulation.
+//
+// usage: reactor_batch [ncells] [nthreads] [nsteps] [mechanism] [phase]
+//                      [integrator] [substeps] [rtol]
+//
+// where integrator is one of CVODE (default), Rosenbrock or RungeKutta. Each
+// step is divided into *substeps* calls to ReactorBatch::advance (default
+// 1), each of which restarts the integrator for every cell, so comparing the
+// integrators with many substeps measures the cost of restarting them.
+
+#include "cantera/zerodim.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/base/clockWC.h"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cantera;
+
+int main(int argc, char** argv)
+{
+    size_t ncells = (argc > 1) ? atoi(argv[1]) : 2000;
+    size_t nthreads = (argc > 2) ? atoi(argv[2]) : 1;
+    int nsteps = (argc > 3) ? atoi(argv[3]) : 5;
+    std::string mech = (argc > 4) ? argv[4] : "gri30.xml";
+    std::string phase = (argc > 5) ? argv[5] : "gri30_mix";
+    std::string integrator = (argc > 6) ? argv[6] : "CVODE";
+    int nsub = (argc > 7) ? atoi(argv[7]) : 1;
+    double rtol = (argc > 8) ? atof(argv[8]) : -1.0;
+    double dt = 1e-5;
+
+    try {
+        IdealGasMix gas(mech, phase);
+        ReactorBatch batch(mech, phase);
+        batch.setThreads(nthreads);
+        batch.setIntegratorType(integrator);
+        if (rtol > 0.0) {
+            batch.setTolerances(rtol, -1.0);
+        }
+        size_t nsp = batch.nSpecies();
+
+        // A mixing layer between cold fuel and hot air, in which the cells
+        // near the hot side ignite during the run
+        vector_fp x(nsp);
+        vector_fp state(ncells * batch.stateSize());
+        for (size_t i = 0; i < ncells; i++) {
+            double z = double(i) / std::max<size_t>(ncells - 1, 1);
+            std::fill(x.begin(), x.end(), 0.0);
+            x[gas.speciesIndex("CH4")] = 0.1 * (1.0 - z);
+            x[gas.speciesIndex("O2")] = 0.21;
+            x[gas.speciesIndex("N2")] = 0.79;
+            gas.setState_TPX(600.0 + 1000.0 * z, OneAtm, &x[0]);
+            double* y = &state[i * batch.stateSize()];
+            y[0] = gas.temperature();
+            y[1] = gas.pressure();
+            gas.getMassFractions(y + 2);
+        }
+
+        printf("%d cells, %d species, %d threads, %s integrator, "
+               "%d substeps\n", int(ncells), int(nsp), int(nthreads),
+               integrator.c_str(), nsub);
+        clockWC clock;
+        double total = 0.0;
+        for (int n = 0; n < nsteps; n++) {
+            clock.start();
+            int nevals = 0;
+            for (int m = 0; m < nsub; m++) {
+                batch.advance(ncells, &state[0], dt / nsub);
+                for (size_t i = 0; i < ncells; i++) {
+                    nevals += batch.nEvals(i);
+                }
+            }
+            double t = clock.secondsWC();
+            total += t;
+            printf("step %2d: %8.3f s, %10.1f cells/s, %8d RHS evaluations\n",
+                   n, t, ncells / t, nevals);
+        }
+        printf("average: %10.1f cells/s\n", nsteps * ncells / total);
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -24,21 +24,6 @@ using std::endl;
 namespace Cantera
 {
 
-// If running multiple threads in a cpp application, the Application class
-// is the only internal object that is single instance with static data.
-
-#ifdef THREAD_SAFE_CANTERA
-cthreadId_t getThisThreadId()
-{
-#if defined(BOOST_HAS_WINTHREADS)
-    return ::GetCurrentThreadId();
-#elif defined(BOOST_HAS_PTHREADS)
-    return pthread_self();
-#endif
-}
-
-#endif
-
 //! Mutex for input directory access
 static mutex_t dir_mutex;
 
@@ -48,6 +33,9 @@ static mutex_t app_mutex;
 //! Mutex for controlling access to XML file storage
 static mutex_t xml_mutex;
 
+//! Mutex for the list of deprecation warnings that have been issued
+static mutex_t warn_mutex;
+
 static int get_modified_time(const std::string& path) {
 #ifdef _WIN32
     HANDLE hFile = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_WRITE,
@@ -66,22 +54,19 @@ static int get_modified_time(const std::string& path) {
 #endif
 }
 
-Application::Messages::Messages() :
-    logwriter(0)
+//! Mutex for replacing the logger
+static mutex_t log_mutex;
+
+shared_ptr<Logger> Application::Messages::logwriter;
+
+Application::Messages::Messages()
 {
-    // install a default logwriter that writes to standard
-    // output / standard error
-    logwriter = new Logger();
 }
 
 Application::Messages::Messages(const Messages& r) :
     errorMessage(r.errorMessage),
-    errorRoutine(r.errorRoutine),
-    logwriter(0)
+    errorRoutine(r.errorRoutine)
 {
-    // install a default logwriter that writes to standard
-    // output / standard error
-    logwriter = new Logger(*(r.logwriter));
 }
 
 Application::Messages& Application::Messages::operator=(const Messages& r)
@@ -91,13 +76,12 @@ Application::Messages& Application::Messages::operator=(const Messages& r)
     }
     errorMessage = r.errorMessage;
     errorRoutine = r.errorRoutine;
-    logwriter = new Logger(*(r.logwriter));
     return *this;
 }
 
 Application::Messages::~Messages()
 {
-    delete logwriter;
+    flushlog();
 }
 
 void Application::Messages::addError(const std::string& r, const std::string& msg)
@@ -111,77 +95,104 @@ int Application::Messages::getErrorCount()
     return static_cast<int>(errorMessage.size()) ;
 }
 
+shared_ptr<Logger> Application::Messages::logger()
+{
+    ScopedLock logLock(log_mutex);
+    return logwriter;
+}
+
 void Application::Messages::setLogger(Logger* _logwriter)
 {
-    if (logwriter == _logwriter) {
-        return ;
-    }
-    if (logwriter != 0) {
-        delete logwriter;
-        logwriter = 0 ;
+    // The old logger is deleted when 'old' goes out of scope, after the lock
+    // is released, unless another thread is still using it
+    shared_ptr<Logger> old;
+    ScopedLock logLock(log_mutex);
+    if (logwriter.get() == _logwriter) {
+        return;
     }
-    logwriter = _logwriter;
+    old = logwriter;
+    logwriter.reset(_logwriter);
 }
 
 void Application::Messages::logerror(const std::string& msg)
 {
     Cantera::warn_deprecated("Application::Messages::logerror");
-    logwriter->error(msg) ;
+    shared_ptr<Logger> log = logger();
+    if (log) {
+        log->error(msg);
+    }
 }
 
 void Application::Messages::writelog(const std::string& msg)
 {
-    logwriter->write(msg);
+    // Only pass complete lines to the logger, so that lines written by
+    // different threads are not mixed together
+    size_t iend = msg.rfind('\n');
+    if (iend == npos) {
+        m_logBuffer += msg;
+        return;
+    }
+    m_logBuffer.append(msg, 0, iend + 1);
+    shared_ptr<Logger> log = logger();
+    if (log) {
+        log->write(m_logBuffer);
+    }
+    m_logBuffer = msg.substr(iend + 1);
 }
 
 void Application::Messages::writelogendl()
 {
-    logwriter->writeendl();
+    shared_ptr<Logger> log = logger();
+    if (log) {
+        if (!m_logBuffer.empty()) {
+            log->write(m_logBuffer);
+            m_logBuffer.clear();
+        }
+        log->writeendl();
+    }
 }
 
-#ifdef THREAD_SAFE_CANTERA
-
-//! Mutex for access to string messages
-static mutex_t msg_mutex;
+void Application::Messages::flushlog()
+{
+    if (m_logBuffer.empty()) {
+        return;
+    }
+    shared_ptr<Logger> log = logger();
+    if (log) {
+        log->write(m_logBuffer);
+        m_logBuffer.clear();
+    }
+}
 
 Application::Messages* Application::ThreadMessages::operator ->()
 {
-    ScopedLock msgLock(msg_mutex);
-    cthreadId_t curId = getThisThreadId() ;
-    threadMsgMap_t::iterator iter = m_threadMsgMap.find(curId) ;
-    if (iter != m_threadMsgMap.end()) {
-        return iter->second.get();
+    Messages* msgs = m_threadMsgs.get();
+    if (!msgs) {
+        msgs = new Messages();
+        m_threadMsgs.reset(msgs);
     }
-    pMessages_t pMsgs(new Messages()) ;
-    m_threadMsgMap.insert(std::pair< cthreadId_t, pMessages_t >(curId, pMsgs)) ;
-    return pMsgs.get() ;
+    return msgs;
 }
 
 void Application::ThreadMessages::removeThreadMessages()
 {
-    ScopedLock msgLock(msg_mutex);
-    cthreadId_t curId = getThisThreadId() ;
-    threadMsgMap_t::iterator iter = m_threadMsgMap.find(curId) ;
-    if (iter != m_threadMsgMap.end()) {
-        m_threadMsgMap.erase(iter) ;
-    }
+    m_threadMsgs.reset();
 }
-#endif // THREAD_SAFE_CANTERA
 
 Application::Application() :
     stop_on_error(false),
     m_suppress_deprecation_warnings(false)
 {
-#if !defined( THREAD_SAFE_CANTERA )
-    pMessenger = std::auto_ptr<Messages>(new Messages());
-#endif
-
     // install a default logwriter that writes to standard
     // output / standard error
+    {
+        ScopedLock logLock(log_mutex);
+        if (!Messages::logwriter) {
+            Messages::logwriter.reset(new Logger());
+        }
+    }
     setDefaultDirectories();
-#if defined(THREAD_SAFE_CANTERA)
     Unit::units() ;
-#endif
 }
 
 Application* Application::Instance()
@@ -201,6 +212,11 @@ Application::~Application()
         delete pos->second.first;
         pos->second.first = 0;
     }
+    // Write out any remaining output from this thread before deleting the
+    // logger
+    pMessenger.removeThreadMessages();
+    ScopedLock logLock(log_mutex);
+    Messages::logwriter.reset();
 }
 
 void Application::ApplicationDestroy()
@@ -215,19 +231,20 @@ void Application::ApplicationDestroy()
 void Application::warn_deprecated(const std::string& method,
                                   const std::string& extra)
 {
-    if (m_suppress_deprecation_warnings || warnings.count(method)) {
+    if (m_suppress_deprecation_warnings) {
+        return;
+    }
+    ScopedLock warnLock(warn_mutex);
+    if (!warnings.insert(method).second) {
         return;
     }
-    warnings.insert(method);
     writelog("WARNING: '" + method + "' is deprecated. " + extra);
     writelogendl();
 }
 
 void Application::thread_complete()
 {
-#if defined(THREAD_SAFE_CANTERA)
     pMessenger.removeThreadMessages() ;
-#endif
 }
 
 XML_Node* Application::get_XML_File(const std::string& file, int debug)
@@ -303,10 +320,10 @@ void Application::close_XML_File(const std::string& file)
         std::map<string, std::pair<XML_Node*, int> >::iterator
         b = xmlfiles.begin(),
         e = xmlfiles.end();
-        for (; b != e; ++b) {
+        while (b != e) {
             b->second.first->unlock();
             delete b->second.first;
-            xmlfiles.erase(b->first);
+            xmlfiles.erase(b++);
         }
     } else if (xmlfiles.find(file) != xmlfiles.end()) {
         xmlfiles[file].first->unlock();
@@ -5,6 +5,7 @@
 #include "cantera/base/config.h"
 #include "cantera/base/ct_thread.h"
 #include "cantera/base/logger.h"
+#include "cantera/base/smart_ptr.h"
 
 #include <set>
 #include <memory>
@@ -134,6 +135,17 @@ protected:
         //! Write an end of line character to the screen and flush output
         void writelogendl();
 
+        //! Write out any text passed to writelog() that is still buffered.
+        /*!
+         * Each thread collects the text passed to writelog() until a
+         * complete line is available, so that lines written by different
+         * threads are not interleaved. This writes out the incomplete last
+         * line, if any.
+         *
+         * @ingroup textlogs
+         */
+        void flushlog();
+
         //! Write an error message and quit.
         /*!
          *  The default behavior is to write to the standard error stream, and
@@ -153,6 +165,9 @@ protected:
          *  Called by the language interfaces to install an appropriate logger.
          *  The logger is used for the writelog() function
          *
+         * The logger is shared by all threads, and takes ownership of
+         * *logwriter*.
+         *
          * @param logwriter Pointer to a logger object
          * @see Logger.
          * @ingroup textlogs
@@ -160,22 +175,33 @@ protected:
         void setLogger(Logger* logwriter) ;
 
     protected:
+        friend class Application;
+
         //! Current list of error messages
         std::vector<std::string> errorMessage;
 
         //! Current error Routine
         std::vector<std::string> errorRoutine;
 
-        //! Current pointer to the logwriter
-        Logger* logwriter;
-    } ;
+        //! Get the current logwriter. The lock is only held while the pointer
+        //! is copied, so the logwriter is called without holding it, and is
+        //! not deleted by setLogger() until the call returns.
+        static shared_ptr<Logger> logger();
+
+        //! Current pointer to the logwriter, which is shared by all threads
+        static shared_ptr<Logger> logwriter;
 
-#ifdef THREAD_SAFE_CANTERA
-    //! Typedef for thread specific messages
-    typedef boost::shared_ptr< Messages >   pMessages_t ;
+        //! Text passed to writelog() which has not yet been written out
+        std::string m_logBuffer;
+    } ;
 
-    //! Class that stores thread messages for each thread, and retrieves them
-    //! based on the thread id.
+    //! Class that stores a separate Messages object for each thread.
+    /*!
+     * The Messages object for the calling thread is held in thread-specific
+     * storage, so accessing it does not require any locking. The object is
+     * created the first time it is used by each thread, and is deleted when
+     * the thread exits or calls removeThreadMessages().
+     */
     class ThreadMessages
     {
     public:
@@ -184,21 +210,17 @@ protected:
 
         //! Provide a pointer dereferencing overloaded operator
         /*!
-         * @return  returns a pointer to Messages
+         * @return  returns a pointer to the Messages for the calling thread
          */
         Messages* operator->();
 
         //! Remove a local thread message
         void removeThreadMessages();
 
-        //! Typedef for map between a thread and the message
-        typedef std::map< cthreadId_t, pMessages_t > threadMsgMap_t ;
-
     private:
-        //! Thread Msg Map
-        threadMsgMap_t   m_threadMsgMap ;
+        //! Messages for each thread
+        thread_specific_ptr<Messages> m_threadMsgs;
     } ;
-#endif
 
 
 protected:
@@ -334,6 +356,11 @@ public:
         pMessenger->writelogendl();
     }
 
+    //! @copydoc Messages::flushlog
+    void flushlog() {
+        pMessenger->flushlog();
+    }
+
      //! @copydoc Messages::logerror
     void logerror(const std::string& msg) {
         pMessenger->logerror(msg);
@@ -359,9 +386,9 @@ public:
     //! Delete and free memory allocated per thread in multithreaded applications
     /*!
      * Delete the memory allocated per thread by Cantera.  It should be called
-     * from within the thread just before the thread terminates.  If your
-     * version of Cantera has not been specifically compiled for thread safety
-     * this function does nothing.
+     * from within the thread just before the thread terminates. Any log
+     * output buffered for the thread is written out first. On platforms other
+     * than Windows, this is also done automatically when the thread exits.
      */
     void thread_complete() ;
 
@@ -421,14 +448,8 @@ protected:
 
     bool m_suppress_deprecation_warnings;
 
-    //! Current pointer to the logwriter
-    //Logger* logwriter;
-
-#if defined(THREAD_SAFE_CANTERA)
+    //! Error messages and log output of each thread
     ThreadMessages   pMessenger ;
-#else
-    std::auto_ptr<Messages> pMessenger ;
-#endif
 
 private:
     //! Pointer to the single Application instance
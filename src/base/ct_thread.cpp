@@ -0,0 +1,228 @@
+/**
+ *  @file ct_thread.cpp
+ *  Mutexes and thread-specific storage using the native threads API.
+ */
+
+#include "cantera/base/ct_thread.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/global.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+namespace Cantera
+{
+
+namespace {
+
+//! The function and argument for a thread_t, passed to the native API
+struct ThreadStart {
+    void (*func)(void*);
+    void* arg;
+};
+
+//! Call the function for a new thread, and clean up the per-thread data of
+//! the library when it returns.
+void startThread(ThreadStart* start)
+{
+    start->func(start->arg);
+    delete start;
+    thread_complete();
+}
+
+}
+
+#ifdef _WIN32
+
+mutex_t::mutex_t()
+{
+    CRITICAL_SECTION* cs = new CRITICAL_SECTION;
+    InitializeCriticalSection(cs);
+    m_mutex = cs;
+}
+
+mutex_t::~mutex_t()
+{
+    CRITICAL_SECTION* cs = static_cast<CRITICAL_SECTION*>(m_mutex);
+    DeleteCriticalSection(cs);
+    delete cs;
+}
+
+void mutex_t::lock()
+{
+    EnterCriticalSection(static_cast<CRITICAL_SECTION*>(m_mutex));
+}
+
+void mutex_t::unlock()
+{
+    LeaveCriticalSection(static_cast<CRITICAL_SECTION*>(m_mutex));
+}
+
+static unsigned __stdcall runThread(void* start)
+{
+    startThread(static_cast<ThreadStart*>(start));
+    return 0;
+}
+
+thread_t::thread_t(void (*func)(void*), void* arg)
+{
+    ThreadStart* start = new ThreadStart;
+    start->func = func;
+    start->arg = arg;
+    uintptr_t h = _beginthreadex(0, 0, runThread, start, 0, 0);
+    if (!h) {
+        delete start;
+        throw CanteraError("thread_t", "_beginthreadex failed");
+    }
+    m_thread = reinterpret_cast<void*>(h);
+}
+
+void thread_t::join()
+{
+    if (m_thread) {
+        HANDLE h = static_cast<HANDLE>(m_thread);
+        WaitForSingleObject(h, INFINITE);
+        CloseHandle(h);
+        m_thread = 0;
+    }
+}
+
+thread_t::~thread_t()
+{
+    join();
+}
+
+ThreadSpecificKey::ThreadSpecificKey(void (*cleanup)(void*))
+{
+    DWORD index = TlsAlloc();
+    if (index == TLS_OUT_OF_INDEXES) {
+        throw CanteraError("ThreadSpecificKey",
+                           "Unable to allocate thread-local storage");
+    }
+    m_key = new DWORD(index);
+}
+
+ThreadSpecificKey::~ThreadSpecificKey()
+{
+    DWORD* index = static_cast<DWORD*>(m_key);
+    TlsFree(*index);
+    delete index;
+}
+
+void* ThreadSpecificKey::get() const
+{
+    return TlsGetValue(*static_cast<DWORD*>(m_key));
+}
+
+void ThreadSpecificKey::set(void* value)
+{
+    TlsSetValue(*static_cast<DWORD*>(m_key), value);
+}
+
+#else
+
+mutex_t::mutex_t()
+{
+    pthread_mutex_t* m = new pthread_mutex_t;
+    int err = pthread_mutex_init(m, 0);
+    if (err) {
+        delete m;
+        throw CanteraError("mutex_t", "pthread_mutex_init failed with "
+                           "error code " + int2str(err));
+    }
+    m_mutex = m;
+}
+
+mutex_t::~mutex_t()
+{
+    pthread_mutex_t* m = static_cast<pthread_mutex_t*>(m_mutex);
+    pthread_mutex_destroy(m);
+    delete m;
+}
+
+void mutex_t::lock()
+{
+    pthread_mutex_lock(static_cast<pthread_mutex_t*>(m_mutex));
+}
+
+void mutex_t::unlock()
+{
+    pthread_mutex_unlock(static_cast<pthread_mutex_t*>(m_mutex));
+}
+
+extern "C" {
+static void* runThread(void* start)
+{
+    startThread(static_cast<ThreadStart*>(start));
+    return 0;
+}
+}
+
+thread_t::thread_t(void (*func)(void*), void* arg)
+{
+    ThreadStart* start = new ThreadStart;
+    start->func = func;
+    start->arg = arg;
+    pthread_t* t = new pthread_t;
+    int err = pthread_create(t, 0, runThread, start);
+    if (err) {
+        delete start;
+        delete t;
+        throw CanteraError("thread_t", "pthread_create failed with "
+                           "error code " + int2str(err));
+    }
+    m_thread = t;
+}
+
+void thread_t::join()
+{
+    if (m_thread) {
+        pthread_t* t = static_cast<pthread_t*>(m_thread);
+        pthread_join(*t, 0);
+        delete t;
+        m_thread = 0;
+    }
+}
+
+thread_t::~thread_t()
+{
+    join();
+}
+
+ThreadSpecificKey::ThreadSpecificKey(void (*cleanup)(void*))
+{
+    pthread_key_t* key = new pthread_key_t;
+    int err = pthread_key_create(key, cleanup);
+    if (err) {
+        delete key;
+        throw CanteraError("ThreadSpecificKey", "pthread_key_create failed "
+                           "with error code " + int2str(err));
+    }
+    m_key = key;
+}
+
+ThreadSpecificKey::~ThreadSpecificKey()
+{
+    pthread_key_t* key = static_cast<pthread_key_t*>(m_key);
+    pthread_key_delete(*key);
+    delete key;
+}
+
+void* ThreadSpecificKey::get() const
+{
+    return pthread_getspecific(*static_cast<pthread_key_t*>(m_key));
+}
+
+void ThreadSpecificKey::set(void* value)
+{
+    pthread_setspecific(*static_cast<pthread_key_t*>(m_key), value);
+}
+
+#endif
+
+}
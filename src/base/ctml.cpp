@@ -365,13 +365,13 @@ size_t getFloatArray(const Cantera::XML_Node& node, std::vector<doublereal> & v,
         vmax = fpValueCheck(readNode->attrib("max"));
     }
 
-    std::string val = readNode->value();
+    const std::string& val = readNode->value();
+    size_t start = 0;
     while (true) {
-        size_t icom = val.find(',');
+        size_t icom = val.find(',', start);
         if (icom != string::npos) {
-            string numstr = val.substr(0,icom);
-            val = val.substr(icom+1,val.size());
-            v.push_back(fpValueCheck(numstr));
+            v.push_back(fpValueCheck(val.substr(start, icom - start)));
+            start = icom + 1;
         } else {
             /*
              * This little bit of code is to allow for the
@@ -381,8 +381,8 @@ size_t getFloatArray(const Cantera::XML_Node& node, std::vector<doublereal> & v,
              * would appear to be odd. So, we keep the
              * possibility in for backwards compatibility.
              */
-            if (!val.empty()) {
-                v.push_back(fpValueCheck(val));
+            if (start < val.size()) {
+                v.push_back(fpValueCheck(val.substr(start)));
             }
             break;
         }
@@ -66,6 +66,11 @@ void writelogendl()
     app()->writelogendl();
 }
 
+void flushlog()
+{
+    app()->flushlog();
+}
+
 void writeline(char repeat, size_t count, bool endl_after, bool endl_before)
 {
     if (endl_before) {
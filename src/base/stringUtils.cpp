@@ -21,6 +21,8 @@
 
 #include <sstream>
 #include <cstdio>
+#include <cstdlib>
+#include <clocale>
 
 namespace Cantera
 {
@@ -284,6 +286,11 @@ doublereal fpValueCheck(const std::string& val)
                                "Trouble processing string, " + str);
         }
     }
+    // strtod is much faster than a stringstream, but uses the decimal
+    // separator of the current locale
+    if (*localeconv()->decimal_point == '.') {
+        return strtod(str.c_str(), 0);
+    }
     return fpValue(str);
 }
 
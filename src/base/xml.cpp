@@ -12,6 +12,7 @@
 #include "cantera/base/utilities.h"
 
 #include <sstream>
+#include <algorithm>
 
 using namespace std;
 
@@ -109,15 +110,23 @@ public:
 
 XML_Reader::XML_Reader(std::istream& input) :
     m_s(input),
+    m_pos(0),
     m_line(0)
 {
+    // Reading the whole input at once is much faster than reading it one
+    // character at a time from the stream.
+    std::ostringstream contents;
+    contents << input.rdbuf();
+    m_buf = contents.str();
 }
 
 void XML_Reader::getchr(char& ch)
 {
-    m_s.get(ch);
-    if (ch == '\n') {
-        m_line++;
+    if (m_pos < m_buf.size()) {
+        ch = m_buf[m_pos++];
+        if (ch == '\n') {
+            m_line++;
+        }
     }
 }
 
@@ -234,37 +243,66 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 {
     string name, tag = "";
     bool incomment = false;
-    char ch  = '-';
-    while (1) {
-        if (m_s.eof() || (getchr(ch), ch == '<')) {
-            break;
-        }
+    size_t n = m_buf.size();
+
+    // skip to the start of the next tag
+    size_t start = m_buf.find('<', m_pos);
+    if (start == string::npos) {
+        start = n;
     }
-    char ch1 = ' ', ch2 = ' ';
-    while (1) {
-        if (m_s.eof()) {
-            tag = "EOF";
-            break;
+    m_line += std::count(m_buf.begin() + m_pos, m_buf.begin() + start, '\n');
+    m_pos = std::min(start + 1, n);
+
+    size_t end = m_buf.find('>', m_pos);
+    const char* comment = "!--";
+    if (start == n || end == string::npos) {
+        m_line += std::count(m_buf.begin() + m_pos, m_buf.end(), '\n');
+        m_pos = n;
+        tag = "EOF";
+    } else if (std::search(m_buf.begin() + m_pos, m_buf.begin() + end,
+                           comment, comment + 3) == m_buf.begin() + end) {
+        // Not a comment: the tag ends at the first '>'. Non-printing
+        // characters are dropped.
+        tag.reserve(end - m_pos);
+        for (size_t i = m_pos; i < end; i++) {
+            char ch = m_buf[i];
+            if (ch == '\n') {
+                m_line++;
+            }
+            if (isprint(ch)) {
+                tag += ch;
+            }
         }
-        ch2 = ch1;
-        ch1 = ch;
-        getchr(ch);
-        if (ch == '-') {
-            if (ch1 == '-' && ch2 == '!') {
-                incomment = true;
-                tag = "-";
+        m_pos = end + 1;
+    } else {
+        // Comment, which may contain '>' and ends with "-->"
+        char ch = '<', ch1 = ' ', ch2 = ' ';
+        while (1) {
+            if (m_pos >= n) {
+                tag = "EOF";
+                incomment = false;
+                break;
             }
-        } else if (ch == '>') {
-            if (incomment) {
-                if (ch1 == '-' && ch2 == '-') {
+            ch2 = ch1;
+            ch1 = ch;
+            getchr(ch);
+            if (ch == '-') {
+                if (ch1 == '-' && ch2 == '!') {
+                    incomment = true;
+                    tag = "-";
+                }
+            } else if (ch == '>') {
+                if (incomment) {
+                    if (ch1 == '-' && ch2 == '-') {
+                        break;
+                    }
+                } else {
                     break;
                 }
-            } else {
-                break;
             }
-        }
-        if (isprint(ch)) {
-            tag += ch;
+            if (isprint(ch)) {
+                tag += ch;
+            }
         }
     }
     if (incomment) {
@@ -278,31 +316,30 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 
 std::string XML_Reader::readValue()
 {
+    // The value extends to the start of the next tag
+    size_t end = m_buf.find('<', m_pos);
+    if (end == string::npos) {
+        end = m_buf.size();
+    }
     string tag = "";
-    char ch, lastch;
-    ch = '\n';
+    tag.reserve(end - m_pos);
+    char ch = '\n', lastch;
     bool front = true;
-    while (1) {
-        if (m_s.eof()) {
-            break;
-        }
+    for (size_t i = m_pos; i < end; i++) {
         lastch = ch;
-        getchr(ch);
+        ch = m_buf[i];
         if (ch == '\n') {
+            m_line++;
             front = true;
         } else if (ch != ' ') {
             front = false;
         }
-        if (ch == '<') {
-            m_s.putback(ch);
-            break;
-        }
-        if (front && lastch == ' ' && ch == ' ') {
-            ;
-        } else {
+        // Collapse indentation at the start of each line to a single space
+        if (!(front && lastch == ' ' && ch == ' ')) {
             tag += ch;
         }
     }
+    m_pos = end;
     return stripws(tag);
 }
 
@@ -757,7 +794,7 @@ void XML_Node::build(std::istream& f)
     string nm, nm2, val;
     XML_Node* node = this;
     map<string, string> node_attribs;
-    while (!f.eof()) {
+    while (!r.eof()) {
         node_attribs.clear();
         nm = r.readTag(node_attribs);
 
@@ -772,7 +809,7 @@ void XML_Node::build(std::istream& f)
             nm2 = nm.substr(0,nm.size()-1);
             node = &node->addChild(nm2);
             node->addValue("");
-            node->attribs() = node_attribs;
+            node->attribs().swap(node_attribs);
             node->setLineNumber(lnum);
             node = node->parent();
         } else if (nm[0] != '/') {
@@ -780,7 +817,7 @@ void XML_Node::build(std::istream& f)
                 node = &node->addChild(nm);
                 val = r.readValue();
                 node->addValue(val);
-                node->attribs() = node_attribs;
+                node->attribs().swap(node_attribs);
                 node->setLineNumber(lnum);
             } else if (nm.substr(0,2) == "--") {
                 if (nm.substr(nm.size()-2,2) == "--") {
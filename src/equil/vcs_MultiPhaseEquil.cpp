@@ -28,14 +28,22 @@ namespace VCSnonideal
 vcs_MultiPhaseEquil::vcs_MultiPhaseEquil() :
     m_vprob(0, 0, 0),
     m_mix(0),
-    m_printLvl(0)
+    m_printLvl(0),
+    m_reuseSolver(false),
+    m_solverReady(false),
+    m_nWarmStarts(0),
+    m_nWarmStartFailures(0)
 {
 }
 
 vcs_MultiPhaseEquil::vcs_MultiPhaseEquil(Cantera::MultiPhase* mix, int printLvl) :
     m_vprob(mix->nSpecies(), mix->nElements(), mix->nPhases()),
     m_mix(0),
-    m_printLvl(printLvl)
+    m_printLvl(printLvl),
+    m_reuseSolver(false),
+    m_solverReady(false),
+    m_nWarmStarts(0),
+    m_nWarmStartFailures(0)
 {
     m_mix = mix;
     m_vprob.m_printLvl = m_printLvl;
@@ -180,6 +188,8 @@ int vcs_MultiPhaseEquil::equilibrate_HP(doublereal Htarget,
     doublereal cpb = 1.0, Tnew;
     doublereal Hlow = Undef;
     doublereal Hhigh = Undef;
+    doublereal Told = Undef;
+    doublereal Hold = Undef;
     doublereal Tnow = m_mix->temperature();
     int printLvlSub = std::max(printLvl - 1, 0);
 
@@ -220,18 +230,30 @@ int vcs_MultiPhaseEquil::equilibrate_HP(doublereal Htarget,
                     Hhigh = Hnow;
                 }
             }
-            double dT, dTa, dTmax, Tnew;
-            if (Hlow != Undef && Hhigh != Undef) {
-                cpb = (Hhigh - Hlow)/(Thigh - Tlow);
-                dT = (Htarget - Hnow)/cpb;
-                dTa = fabs(dT);
-                dTmax = 0.5*fabs(Thigh - Tlow);
-                if (dTa > dTmax) {
-                    dT *= dTmax/dTa;
-                }
+            // Estimate dH/dT from the secant through the two most recent
+            // solutions, which includes the effect of the shift in the
+            // equilibrium composition. For the first step, use the heat
+            // capacity at the current composition.
+            if (Told != Undef && Tnow != Told && (Hnow - Hold)/(Tnow - Told) > 0.0) {
+                cpb = (Hnow - Hold)/(Tnow - Told);
             } else {
-                Tnew = sqrt(Tlow*Thigh);
-                dT = clip(Tnew - Tnow, -200.0, 200.0);
+                cpb = m_mix->cp();
+            }
+            Told = Tnow;
+            Hold = Hnow;
+            double dT = (Htarget - Hnow)/cpb;
+            double Tnew = Tnow + dT;
+
+            // Keep the new temperature within the current bracket
+            if (Tnew <= Tlow || Tnew >= Thigh) {
+                if (Hlow != Undef && Hhigh != Undef) {
+                    Tnew = 0.5*(Tlow + Thigh);
+                } else if (Tnew >= Thigh) {
+                    Tnew = 0.5*(Tnow + Thigh);
+                } else {
+                    Tnew = 0.5*(Tnow + Tlow);
+                }
+                dT = Tnew - Tnow;
             }
             double acpb = std::max(fabs(cpb), 1.0E-6);
             double denom = std::max(fabs(Htarget), acpb);
@@ -254,6 +276,36 @@ int vcs_MultiPhaseEquil::equilibrate_HP(doublereal Htarget,
                 goto done;
             }
             Tnew = Tnow + dT;
+            if (n == 0) {
+                // For the first step, refine the estimate by finding the
+                // temperature at which the mixture would have the target
+                // enthalpy if its composition were fixed. This only
+                // requires evaluating the thermodynamic properties. MultiPhase
+                // does not provide c_v, so for UP the slope is the secant
+                // through the last two fixed-composition values.
+                double Tprev = Tnow;
+                double Hprev = Hnow;
+                for (int i = 0; i < 4 && Tnew > Tlow && Tnew < Thigh; i++) {
+                    m_mix->setTemperature(Tnew);
+                    double Hf = (XY == UP) ? m_mix->IntEnergy() : m_mix->enthalpy();
+                    if (XY == UP) {
+                        if (Tnew == Tprev || (Hf - Hprev)/(Tnew - Tprev) <= 0.0) {
+                            break;
+                        }
+                        cpb = (Hf - Hprev)/(Tnew - Tprev);
+                    } else {
+                        cpb = m_mix->cp();
+                    }
+                    Tprev = Tnew;
+                    Hprev = Hf;
+                    dT = (Htarget - Hf)/cpb;
+                    Tnew += dT;
+                    if (fabs(dT) < 1.0) {
+                        break;
+                    }
+                }
+                Tnew = clip(Tnew, 0.5*(Tnow + Tlow), 0.5*(Tnow + Thigh));
+            }
             if (Tnew < 0.0) {
                 Tnew = 0.5*Tnow;
             }
@@ -297,9 +349,11 @@ int vcs_MultiPhaseEquil::equilibrate_SP(doublereal Starget,
         Thigh = 2.0 * m_mix->maxTemp();
     }
 
-    doublereal cpb = 1.0, dT, dTa, dTmax, Tnew;
+    doublereal cpb = 1.0, dT, Tnew;
     doublereal Slow = Undef;
     doublereal Shigh = Undef;
+    doublereal Told = Undef;
+    doublereal Sold = Undef;
     doublereal Tnow = m_mix->temperature();
     Tlow = std::min(Tnow, Tlow);
     Thigh = std::max(Tnow, Thigh);
@@ -348,21 +402,28 @@ int vcs_MultiPhaseEquil::equilibrate_SP(doublereal Starget,
                     Shigh = Snow;
                 }
             }
-            if (Slow != Undef && Shigh != Undef) {
-                cpb = (Shigh - Slow)/(Thigh - Tlow);
-                dT = (Starget - Snow)/cpb;
-                Tnew = Tnow + dT;
-                dTa = fabs(dT);
-                dTmax = 0.5*fabs(Thigh - Tlow);
-                if (Tnew > Thigh || Tnew < Tlow) {
-                    dTmax = 1.5*fabs(Thigh - Tlow);
-                }
-                dTmax = std::min(dTmax, 300.);
-                if (dTa > dTmax) {
-                    dT *= dTmax/dTa;
-                }
+            // Estimate dS/dT from the secant through the two most recent
+            // solutions, or for the first step, from the heat capacity at
+            // the current composition.
+            if (Told != Undef && Tnow != Told && (Snow - Sold)/(Tnow - Told) > 0.0) {
+                cpb = (Snow - Sold)/(Tnow - Told);
             } else {
-                Tnew = sqrt(Tlow*Thigh);
+                cpb = m_mix->cp() / Tnow;
+            }
+            Told = Tnow;
+            Sold = Snow;
+            dT = (Starget - Snow)/cpb;
+            Tnew = Tnow + dT;
+
+            // Keep the new temperature within the current bracket
+            if (Tnew <= Tlow || Tnew >= Thigh) {
+                if (Slow != Undef && Shigh != Undef) {
+                    Tnew = 0.5*(Tlow + Thigh);
+                } else if (Tnew >= Thigh) {
+                    Tnew = 0.5*(Tnow + Thigh);
+                } else {
+                    Tnew = 0.5*(Tnow + Tlow);
+                }
                 dT = Tnew - Tnow;
             }
 
@@ -387,6 +448,19 @@ int vcs_MultiPhaseEquil::equilibrate_SP(doublereal Starget,
                 return iSuccess;
             }
             Tnew = Tnow + dT;
+            if (n == 0) {
+                // Refine the first step using the entropy of the mixture at
+                // fixed composition
+                for (int i = 0; i < 4 && Tnew > Tlow && Tnew < Thigh; i++) {
+                    m_mix->setTemperature(Tnew);
+                    dT = (Starget - m_mix->entropy()) * Tnew / m_mix->cp();
+                    Tnew += dT;
+                    if (fabs(dT) < 1.0) {
+                        break;
+                    }
+                }
+                Tnew = clip(Tnew, 0.5*(Tnow + Tlow), 0.5*(Tnow + Thigh));
+            }
             if (Tnew < 0.0) {
                 Tnew = 0.5*Tnow;
             }
@@ -513,7 +587,27 @@ int vcs_MultiPhaseEquil::equilibrate_TP(int estimateEquil,
     } else {
         ip1 = 0;
     }
-    int iSuccess = m_vsolve.vcs(&m_vprob, 0, ipr, ip1, maxit);
+    int iSuccess;
+    if (m_reuseSolver && m_solverReady) {
+        /*
+         * Resolve the problem starting from the species ordering,
+         * component basis and phase data left by the last solution.
+         * If that fails, set the problem up again from scratch.
+         */
+        m_solverReady = false;
+        m_nWarmStarts++;
+        iSuccess = m_vsolve.vcs(&m_vprob, 1, ipr, ip1, maxit);
+        if (iSuccess != 0) {
+            m_nWarmStartFailures++;
+            vcs_Cantera_update_vprob(m_mix, &m_vprob);
+            m_vprob.iest = estimateEquil;
+            iSuccess = m_vsolve.vcs(&m_vprob, 0, ipr, ip1, maxit);
+        }
+    } else {
+        m_solverReady = false;
+        iSuccess = m_vsolve.vcs(&m_vprob, 0, ipr, ip1, maxit);
+    }
+    m_solverReady = (iSuccess == 0);
 
     /*
      * Transfer the information back to the MultiPhase object.
@@ -211,8 +211,12 @@ int VCS_SOLVE::vcs_prep()
     m_feSpecies_old.assign(m_feSpecies_old.size(), 0.0);
     m_feSpecies_new.assign(m_feSpecies_new.size(), 0.0);
     m_molNumSpecies_new.assign(m_molNumSpecies_new.size(), 0.0);
-    m_deltaMolNumPhase.zero();
-    m_phaseParticipation.zero();
+    if (!m_reuseBasis) {
+        // Keep the reaction data that go with a component basis which
+        // may be reused
+        m_deltaMolNumPhase.zero();
+        m_phaseParticipation.zero();
+    }
     m_deltaPhaseMoles.assign(m_deltaPhaseMoles.size(), 0.0);
     m_tPhaseMoles_new.assign(m_tPhaseMoles_new.size(), 0.0);
     /*
@@ -51,6 +51,7 @@ VCS_SOLVE::VCS_SOLVE() :
     m_totalVol(0.0),
     m_Faraday_dim(Cantera::ElectronCharge* Cantera::Avogadro),
     m_VCount(0),
+    m_reuseBasis(false),
     m_debug_print_lvl(0),
     m_timing_print_lvl(1),
     m_VCS_UnitsFormat(VCS_UNITS_UNITLESS)
@@ -256,6 +257,12 @@ int VCS_SOLVE::vcs(VCS_PROB* vprob, int ifunc, int ipr, int ip1, int maxit)
         return VCS_PUB_BAD;
     }
 
+    /*
+     *  The component basis from the last solution is only kept when the
+     *  problem structure is unchanged, i.e. when the problem is resolved.
+     */
+    m_reuseBasis = m_reuseBasis && (ifunc == 1);
+
     if (ifunc == 0) {
         /*
          *         This function is called to create the private data
@@ -337,6 +344,7 @@ int VCS_SOLVE::vcs(VCS_PROB* vprob, int ifunc, int ipr, int ip1, int maxit)
          *    calculate the residual and Jacobian)
          */
         iconv = vcs_TP(ipr, ip1, maxit, vprob->T, vprob->PresPA);
+        m_reuseBasis = (iconv == 0);
 
         /*
          *        If requested to print anything out, go ahead and do so;
@@ -972,6 +980,7 @@ void VCS_SOLVE::vcs_counters_init(int ifunc)
     if (ifunc) {
         m_VCount->T_Its = 0;
         m_VCount->T_Basis_Opts = 0;
+        m_VCount->T_Basis_Reuses = 0;
         m_VCount->T_Calls_Inest = 0;
         m_VCount->T_Calls_vcs_TP = 0;
         m_VCount->T_Time_vcs_TP = 0.0;
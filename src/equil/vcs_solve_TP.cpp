@@ -373,9 +373,20 @@ int VCS_SOLVE::solve_tp_component_calc(bool& allMinorZeroedSpecies)
 {
     double test = -1.0e-10;
     bool usedZeroedSpecies;
-    int retn = vcs_basopt(false, VCS_DATA_PTR(m_aw), VCS_DATA_PTR(m_sa),
+    int retn = VCS_SUCCESS;
+    if (m_reuseBasis && vcs_basisOptimal()) {
+        /*
+         * The components left over from the previous problem are still
+         * the best choice for the new initial mole numbers, so the
+         * stoichiometric coefficients are kept as well.
+         */
+        (m_VCount->T_Basis_Reuses)++;
+    } else {
+        retn = vcs_basopt(false, VCS_DATA_PTR(m_aw), VCS_DATA_PTR(m_sa),
                           VCS_DATA_PTR(m_sm), VCS_DATA_PTR(m_ss),
                           test, &usedZeroedSpecies);
+    }
+    m_reuseBasis = false;
     if (retn != VCS_SUCCESS) {
         return retn;
     }
@@ -410,6 +421,67 @@ int VCS_SOLVE::solve_tp_component_calc(bool& allMinorZeroedSpecies)
     return retn;
 }
 
+bool VCS_SOLVE::vcs_basisOptimal()
+{
+    for (size_t i = 0; i < m_numRxnRdc; ++i) {
+        size_t l = m_indexRxnToSpecies[i];
+        if (m_speciesUnknownType[l] == VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+            continue;
+        }
+        for (size_t j = 0; j < m_numComponents; ++j) {
+            bool doSwap = false;
+            if (m_SSPhase[j]) {
+                doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
+                         (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
+                if (!m_SSPhase[l] && doSwap) {
+                    doSwap = (m_molNumSpecies_old[l]) > (m_molNumSpecies_old[j] * 1.01);
+                }
+            } else {
+                if (m_SSPhase[l]) {
+                    doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
+                             (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
+                    if (!doSwap) {
+                        doSwap = (m_molNumSpecies_old[l]) > (m_molNumSpecies_old[j] * 1.01);
+                    }
+                } else {
+                    doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
+                             (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
+                }
+            }
+            if (doSwap && m_stoichCoeffRxnMatrix(j,i) != 0.0) {
+                if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
+                    plogf("   --- Get a new basis because ");
+                    plogf("%s", m_speciesName[l].c_str());
+                    plogf(" is better than comp ");
+                    plogf("%s", m_speciesName[j].c_str());
+                    plogf(" and share nonzero stoic: %-9.1f",
+                          m_stoichCoeffRxnMatrix(j,i));
+                    plogendl();
+                }
+                return false;
+            }
+#ifdef DEBUG_NOT
+            if (m_speciesStatus[l] == VCS_SPECIES_ZEROEDMS && m_molNumSpecies_old[j] == 0.0 && m_stoichCoeffRxnMatrix(j,i) != 0.0 && dg[i] < 0.0) {
+                if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
+                    plogf("   --- Get a new basis because %s", m_speciesName[l].c_str());
+                    plogf(" has dg < 0.0 and comp %s has zero mole num",
+                          m_speciesName[j].c_str());
+                    plogf(" and share nonzero stoic: %-9.1f",
+                          m_stoichCoeffRxnMatrix(j,i));
+                    plogendl();
+                }
+                return false;
+            }
+#endif
+        }
+    }
+    if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
+        plogf("   --- Check for an optimum basis passed");
+        plogendl();
+    }
+    return true;
+}
+
 void VCS_SOLVE::solve_tp_inner(size_t& iti, size_t& it1,
                                bool& uptodate_minors,
                                bool& allMinorZeroedSpecies,
@@ -1357,63 +1429,9 @@ void VCS_SOLVE::solve_tp_inner(size_t& iti, size_t& it1,
     /*************************************************************************/
     /***************** CHECK FOR OPTIMUM BASIS *******************************/
     /*************************************************************************/
-
-    for (size_t i = 0; i < m_numRxnRdc; ++i) {
-        size_t l = m_indexRxnToSpecies[i];
-        if (m_speciesUnknownType[l] == VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
-            continue;
-        }
-        for (size_t j = 0; j < m_numComponents; ++j) {
-            bool doSwap = false;
-            if (m_SSPhase[j]) {
-                doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
-                         (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
-                if (!m_SSPhase[l] && doSwap) {
-                    doSwap = (m_molNumSpecies_old[l]) > (m_molNumSpecies_old[j] * 1.01);
-                }
-            } else {
-                if (m_SSPhase[l]) {
-                    doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
-                             (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
-                    if (!doSwap) {
-                        doSwap = (m_molNumSpecies_old[l]) > (m_molNumSpecies_old[j] * 1.01);
-                    }
-                } else {
-                    doSwap = (m_molNumSpecies_old[l] * m_spSize[l]) >
-                             (m_molNumSpecies_old[j] * m_spSize[j] * 1.01);
-                }
-            }
-            if (doSwap && m_stoichCoeffRxnMatrix(j,i) != 0.0) {
-                if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
-                    plogf("   --- Get a new basis because ");
-                    plogf("%s", m_speciesName[l].c_str());
-                    plogf(" is better than comp ");
-                    plogf("%s", m_speciesName[j].c_str());
-                    plogf(" and share nonzero stoic: %-9.1f",
-                          m_stoichCoeffRxnMatrix(j,i));
-                    plogendl();
-                }
-                forceComponentCalc = 1;
-                return;
-            }
-#ifdef DEBUG_NOT
-            if (m_speciesStatus[l] == VCS_SPECIES_ZEROEDMS && m_molNumSpecies_old[j] == 0.0 && m_stoichCoeffRxnMatrix(j,i) != 0.0 && dg[i] < 0.0) {
-                if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
-                    plogf("   --- Get a new basis because %s", m_speciesName[l].c_str());
-                    plogf(" has dg < 0.0 and comp %s has zero mole num",
-                          m_speciesName[j].c_str());
-                    plogf(" and share nonzero stoic: %-9.1f",
-                          m_stoichCoeffRxnMatrix(j,i));
-                    plogendl();
-                }
-                return;
-            }
-#endif
-        }
-    }
-    if (DEBUG_MODE_ENABLED && m_debug_print_lvl >= 2) {
-        plogf("   --- Check for an optimum basis passed");
-        plogendl();
+    if (!vcs_basisOptimal()) {
+        forceComponentCalc = 1;
+        return;
     }
     stage = EQUILIB_CHECK;
     /*************************************************************************/
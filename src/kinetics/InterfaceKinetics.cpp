@@ -115,6 +115,9 @@ InterfaceKinetics& InterfaceKinetics::operator=(const InterfaceKinetics& right)
     m_phaseIsStable        = right.m_phaseIsStable;
     m_rxnPhaseIsReactant   = right.m_rxnPhaseIsReactant;
     m_rxnPhaseIsProduct    = right.m_rxnPhaseIsProduct;
+    m_ropnet_ddC           = right.m_ropnet_ddC;
+    m_dlnk_dtheta          = right.m_dlnk_dtheta;
+    m_rkwork               = right.m_rkwork;
     m_ioFlag               = right.m_ioFlag;
 
     for (size_t i = 0; i <  rmcVector.size(); i++) {
@@ -509,6 +512,72 @@ void InterfaceKinetics::getRevRateConstants(doublereal* krev, bool doIrreversibl
     }
 }
 
+void InterfaceKinetics::getNetProductionRates_ddC(Array2D& dwdot)
+{
+    updateROP();
+    size_t ns = m_surf->nSpecies();
+    size_t kstart = m_start[reactionPhaseIndex()];
+    dwdot.resize(m_kk, ns, 0.0);
+    dwdot.zero();
+    if (m_ii == 0) {
+        return;
+    }
+
+    // Derivatives of the forward and reverse rates of progress with respect
+    // to the activity concentrations. The reverse rate constants are negated
+    // so that both directions accumulate into the net rates of progress.
+    m_ropnet_ddC.resize(m_ii, m_kk, 0.0);
+    m_ropnet_ddC.zero();
+    m_rkwork.resize(m_ii);
+    for (size_t j = 0; j < m_ii; j++) {
+        m_rkwork[j] = - m_rfn[j] * m_perturb[j] * m_rkcn[j];
+    }
+    m_revProductStoich.multiplyDerivatives(DATA_PTR(m_actConc),
+                                           DATA_PTR(m_rkwork), m_ropnet_ddC);
+    for (size_t j = 0; j < m_ii; j++) {
+        m_rkwork[j] = m_rfn[j] * m_perturb[j];
+    }
+    m_reactantStoich.multiplyDerivatives(DATA_PTR(m_actConc),
+                                         DATA_PTR(m_rkwork), m_ropnet_ddC);
+
+    // Both directions scale with the coverage-dependent forward rate constant
+    if (m_has_coverage_dependence) {
+        m_surf->getCoverages(DATA_PTR(m_grt));
+        m_dlnk_dtheta.resize(ns, m_ii, 0.0);
+        m_dlnk_dtheta.zero();
+        m_rates.update_dlnk_dC(DATA_PTR(m_grt), m_temp, m_dlnk_dtheta);
+        doublereal n0 = m_surf->siteDensity();
+        for (size_t k = 0; k < ns; k++) {
+            doublereal dtheta_dC = m_surf->size(k) / n0;
+            for (size_t j = 0; j < m_ii; j++) {
+                m_ropnet_ddC(j, kstart + k) +=
+                    m_ropnet[j] * m_dlnk_dtheta(k, j) * dtheta_dC;
+            }
+        }
+    }
+
+    // Reactions switched off by the phase existence checks in updateROP()
+    if (m_phaseExistsCheck) {
+        for (size_t j = 0; j < m_ii; j++) {
+            if (m_ropnet[j] == 0.0) {
+                for (size_t k = 0; k < m_kk; k++) {
+                    m_ropnet_ddC(j, k) = 0.0;
+                }
+            }
+        }
+    }
+
+    // Convert to species production rates, one surface species at a time.
+    // Columns of both arrays are contiguous.
+    for (size_t k = 0; k < ns; k++) {
+        const doublereal* dropnet = m_ropnet_ddC.ptrColumn(kstart + k);
+        doublereal* dw = dwdot.ptrColumn(k);
+        m_revProductStoich.incrementSpecies(dropnet, dw);
+        m_irrevProductStoich.incrementSpecies(dropnet, dw);
+        m_reactantStoich.decrementSpecies(dropnet, dw);
+    }
+}
+
 void InterfaceKinetics::updateROP()
 {
     // evaluate rate constants and equilibrium constants at temperature and phi (electric potential)
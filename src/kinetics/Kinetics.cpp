@@ -17,6 +17,7 @@ using namespace std;
 namespace Cantera
 {
 Kinetics::Kinetics() :
+    m_stoichMatricesOK(false),
     m_ii(0),
     m_kk(0),
     m_thermo(0),
@@ -50,6 +51,10 @@ Kinetics& Kinetics::operator=(const Kinetics& right)
     m_reactantStoich = right.m_reactantStoich;
     m_revProductStoich = right.m_revProductStoich;
     m_irrevProductStoich = right.m_irrevProductStoich;
+    m_reactantMatrix = right.m_reactantMatrix;
+    m_productMatrix = right.m_productMatrix;
+    m_netMatrix = right.m_netMatrix;
+    m_stoichMatricesOK = right.m_stoichMatricesOK;
     m_ii                = right.m_ii;
     m_kk                = right.m_kk;
     m_perturb           = right.m_perturb;
@@ -369,7 +374,6 @@ string Kinetics::kineticsSpeciesName(size_t k) const
 size_t Kinetics::kineticsSpeciesIndex(const std::string& nm) const
 {
     for (size_t n = 0; n < m_thermo.size(); n++) {
-        string id = thermo(n).id();
         // Check the ThermoPhase object for a match
         size_t k = thermo(n).speciesIndex(nm);
         if (k != npos) {
@@ -386,27 +390,23 @@ size_t Kinetics::kineticsSpeciesIndex(const std::string& nm,
         return kineticsSpeciesIndex(nm);
     }
 
-    for (size_t n = 0; n < m_thermo.size(); n++) {
-        string id = thermo(n).id();
-        if (ph == id) {
-            size_t k = thermo(n).speciesIndex(nm);
-            if (k == npos) {
-                return npos;
-            }
-            return k + m_start[n];
-        }
+    std::map<std::string, size_t>::const_iterator iter = m_phaseindex.find(ph);
+    if (iter == m_phaseindex.end()) {
+        return npos;
     }
-    return npos;
+    size_t n = iter->second - 1;
+    size_t k = thermo(n).speciesIndex(nm);
+    if (k == npos) {
+        return npos;
+    }
+    return k + m_start[n];
 }
 
 thermo_t& Kinetics::speciesPhase(const std::string& nm)
 {
     size_t np = m_thermo.size();
-    size_t k;
-    string id;
     for (size_t n = 0; n < np; n++) {
-        k = thermo(n).speciesIndex(nm);
-        if (k != npos) {
+        if (thermo(n).speciesIndex(nm) != npos) {
             return thermo(n);
         }
     }
@@ -453,6 +453,33 @@ void Kinetics::getNetRatesOfProgress(doublereal* netROP)
     std::copy(m_ropnet.begin(), m_ropnet.end(), netROP);
 }
 
+void Kinetics::updateStoichMatrices()
+{
+    if (m_stoichMatricesOK && m_netMatrix.nRows() == m_kk) {
+        return;
+    }
+    std::vector<std::map<size_t, doublereal> > reac(m_kk), prod(m_kk);
+    for (size_t k = 0; k < std::min(m_kk, m_rrxn.size()); k++) {
+        reac[k] = m_rrxn[k];
+    }
+    for (size_t k = 0; k < std::min(m_kk, m_prxn.size()); k++) {
+        prod[k] = m_prxn[k];
+    }
+    m_reactantMatrix.build(reac, m_ii);
+    m_productMatrix.build(prod, m_ii);
+
+    // net = products - reactants. Species which appear on both sides with
+    // the same coefficient have no net entry.
+    for (size_t k = 0; k < m_kk; k++) {
+        for (std::map<size_t, doublereal>::const_iterator iter = reac[k].begin();
+             iter != reac[k].end(); ++iter) {
+            prod[k][iter->first] -= iter->second;
+        }
+    }
+    m_netMatrix.build(prod, m_ii);
+    m_stoichMatricesOK = true;
+}
+
 void Kinetics::getReactionDelta(const double* prop, double* deltaProp)
 {
     fill(deltaProp, deltaProp + m_ii, 0.0);
@@ -475,39 +502,31 @@ void Kinetics::getRevReactionDelta(const double* prop, double* deltaProp)
 void Kinetics::getCreationRates(double* cdot)
 {
     updateROP();
+    updateStoichMatrices();
 
-    // zero out the output array
-    fill(cdot, cdot + m_kk, 0.0);
-
-    // the forward direction creates product species
-    m_revProductStoich.incrementSpecies(&m_ropf[0], cdot);
-    m_irrevProductStoich.incrementSpecies(&m_ropf[0], cdot);
-
-    // the reverse direction creates reactant species
-    m_reactantStoich.incrementSpecies(&m_ropr[0], cdot);
+    // the forward direction creates product species, and the reverse
+    // direction creates reactant species
+    m_productMatrix.mult(DATA_PTR(m_ropf), m_reactantMatrix,
+                         DATA_PTR(m_ropr), cdot);
 }
 
 void Kinetics::getDestructionRates(doublereal* ddot)
 {
     updateROP();
+    updateStoichMatrices();
 
-    fill(ddot, ddot + m_kk, 0.0);
-    // the reverse direction destroys products in reversible reactions
-    m_revProductStoich.incrementSpecies(&m_ropr[0], ddot);
-    // the forward direction destroys reactants
-    m_reactantStoich.incrementSpecies(&m_ropf[0], ddot);
+    // the forward direction destroys reactants, and the reverse direction
+    // destroys products. The reverse rates of progress of irreversible
+    // reactions are zero.
+    m_reactantMatrix.mult(DATA_PTR(m_ropf), m_productMatrix,
+                          DATA_PTR(m_ropr), ddot);
 }
 
 void Kinetics::getNetProductionRates(doublereal* net)
 {
     updateROP();
-
-    fill(net, net + m_kk, 0.0);
-    // products are created for positive net rate of progress
-    m_revProductStoich.incrementSpecies(&m_ropnet[0], net);
-    m_irrevProductStoich.incrementSpecies(&m_ropnet[0], net);
-    // reactants are destroyed for positive net rate of progress
-    m_reactantStoich.decrementSpecies(&m_ropnet[0], net);
+    updateStoichMatrices();
+    m_netMatrix.mult(DATA_PTR(m_ropnet), net);
 }
 
 void Kinetics::addPhase(thermo_t& thermo)
@@ -642,6 +661,7 @@ void Kinetics::addReaction(ReactionData& r) {
 
     installGroups(nReactions(), r.rgroups, r.pgroups);
     incrementRxnCount();
+    m_stoichMatricesOK = false;
     m_rxneqn.push_back(r.equation);
     m_reactantStrings.push_back(r.reactantString);
     m_productStrings.push_back(r.productString);
@@ -757,6 +777,7 @@ void Kinetics::addReaction(shared_ptr<Reaction> r)
     }
 
     incrementRxnCount();
+    m_stoichMatricesOK = false;
     m_reactions.push_back(r);
     m_rxneqn.push_back(r->equation());
     m_reactantStrings.push_back(r->reactantString());
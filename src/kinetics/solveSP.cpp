@@ -42,7 +42,9 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_rtol(1.0E-4),
     m_maxstep(1000),
     m_maxTotSpecies(0),
-    m_ioflag(0)
+    m_coupledSurfPhases(false),
+    m_ioflag(0),
+    m_numericalJacobian(false)
 {
     m_numSurfPhases = 0;
     size_t numPossibleSurfPhases = m_objects.size();
@@ -71,6 +73,20 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
         m_numTotSurfSpecies += nsp;
 
     }
+    for (size_t n = 0; n < m_numSurfPhases; n++) {
+        InterfaceKinetics* kin = m_objects[n];
+        for (size_t ip = 0; ip < kin->nPhases(); ip++) {
+            if (ip == m_kinObjPhaseIDSurfPhase[n]) {
+                continue;
+            }
+            for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+                if (&kin->thermo(ip) == m_ptrsSurfPhase[isp]) {
+                    m_coupledSurfPhases = true;
+                }
+            }
+        }
+    }
+
     /*
      * We rely on ordering to figure things out
      */
@@ -565,6 +581,37 @@ void solveSP::resjac_eval(SquareMatrix& jac,
      * Calculate the residual
      */
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
+
+    /*
+     * Use the analytic derivatives of the surface production rates when
+     * the unknowns are only surface concentrations. Unless the kinetics
+     * object of a surface phase also contains another of the surface phases,
+     * each surface phase only couples to itself, so the Jacobian is block
+     * diagonal.
+     */
+    if (!m_numericalJacobian && !m_coupledSurfPhases &&
+            m_neq == m_numTotSurfSpecies) {
+        jac.zero();
+        size_t kins = 0;
+        for (jsp = 0; jsp < m_numSurfPhases; jsp++) {
+            nsp = m_nSpeciesSurfPhase[jsp];
+            InterfaceKinetics* kinPtr = m_objects[jsp];
+            size_t kstart = kinPtr->kineticsSpeciesIndex(0, kinPtr->surfacePhaseIndex());
+            kinPtr->getNetProductionRates_ddC(m_dwdot_dC);
+            for (kCol = 0; kCol < nsp; kCol++) {
+                for (i = 0; i < nsp; i++) {
+                    jac(kins + i, kins + kCol) = - m_dwdot_dC(kstart + i, kCol);
+                }
+                if (do_time) {
+                    jac(kins + kCol, kins + kCol) += 1.0 / deltaT;
+                }
+                jac(kins + m_spSurfLarge[jsp], kins + kCol) = -1.0;
+            }
+            kins += nsp;
+        }
+        return;
+    }
+
     /*
      * Now we will look over the columns perturbing each unknown.
      */
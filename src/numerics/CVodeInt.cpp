@@ -309,6 +309,24 @@ double CVodeInt::step(double tout)
     return t;
 }
 
+void CVodeInt::getDenseOutput(double t, int k, double* dky)
+{
+    N_Vector v;
+    N_VMAKE(v, dky, m_neq);
+    int flag = CVodeDky(m_cvode_mem, t, k, v);
+    N_VDISPOSE(v);
+    if (flag != OKAY) {
+        throw CVodeErr("CVodeDky failed for t = " + fp2str(t) +
+                       ", k = " + int2str(k) + ". Error code: " +
+                       int2str(flag));
+    }
+}
+
+double CVodeInt::internalTime()
+{
+    return m_ropt[TCUR];
+}
+
 int CVodeInt::nEvals() const
 {
     return m_iopt[NFE];
@@ -47,6 +47,8 @@ public:
     virtual void reinitialize(double t0, FuncEval& func);
     virtual void integrate(double tout);
     virtual doublereal step(double tout);
+    virtual void getDenseOutput(double t, int k, double* dky);
+    virtual double internalTime();
     virtual double& solution(size_t k);
     virtual double* solution();
     virtual int nEquations() const {
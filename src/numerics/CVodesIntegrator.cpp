@@ -78,6 +78,34 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    /**
+     *  Function called by cvodes to evaluate the right-hand sides of the
+     *  sensitivity equations, if they are provided by the FuncEval object.
+     *  @ingroup odeGroup
+     */
+    static int cvodes_sensrhs(int Ns, realtype t, N_Vector y, N_Vector ydot,
+                              N_Vector* yS, N_Vector* ySdot, void* f_data,
+                              N_Vector tmp1, N_Vector tmp2)
+    {
+        try {
+            Cantera::FuncData* d = (Cantera::FuncData*)f_data;
+            std::vector<double*> s(Ns), sdot(Ns);
+            for (int i = 0; i < Ns; i++) {
+                s[i] = NV_DATA_S(yS[i]);
+                sdot[i] = NV_DATA_S(ySdot[i]);
+            }
+            d->m_func->evalSensitivities(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                         DATA_PTR(s), DATA_PTR(sdot));
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_sensrhs: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0; // successful evaluation
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -111,9 +139,12 @@ CVodesIntegrator::CVodesIntegrator() :
     m_maxsteps(20000),
     m_maxErrTestFails(0),
     m_fdata(0),
+    m_yS(0),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_sensEquations(false),
+    m_recreate(true)
 {
 }
 
@@ -131,6 +162,9 @@ CVodesIntegrator::~CVodesIntegrator()
     if (m_abstol) {
         N_VDestroy_Serial(m_abstol);
     }
+    if (m_yS) {
+        N_VDestroyVectorArray_Serial(m_yS, static_cast<int>(m_np));
+    }
     delete m_fdata;
 }
 
@@ -148,7 +182,7 @@ void CVodesIntegrator::setTolerances(double reltol, size_t n, double* abstol)
 {
     m_itol = CV_SV;
     m_nabs = n;
-    if (n != m_neq) {
+    if (!m_abstol || static_cast<size_t>(NV_LENGTH_S(m_abstol)) != n) {
         if (m_abstol) {
             N_VDestroy_Serial(m_abstol);
         }
@@ -175,18 +209,35 @@ void CVodesIntegrator::setSensitivityTolerances(double reltol, double abstol)
 
 void CVodesIntegrator::setProblemType(int probtype)
 {
-    m_type = probtype;
+    if (probtype != m_type) {
+        m_type = probtype;
+        m_recreate = true;
+    }
 }
 
 void CVodesIntegrator::setMethod(MethodType t)
 {
+    int method;
     if (t == BDF_Method) {
-        m_method = CV_BDF;
+        method = CV_BDF;
     } else if (t == Adams_Method) {
-        m_method = CV_ADAMS;
+        method = CV_ADAMS;
     } else {
         throw CVodesErr("unknown method");
     }
+    if (method != m_method) {
+        m_method = method;
+        m_recreate = true;
+    }
+}
+
+void CVodesIntegrator::setMaxOrder(int n)
+{
+    // CVODES only allows the maximum order of existing memory to be reduced
+    if (m_maxord > 0 && (n <= 0 || n > m_maxord)) {
+        m_recreate = true;
+    }
+    m_maxord = n;
 }
 
 void CVodesIntegrator::setMaxStepSize(doublereal hmax)
@@ -223,46 +274,68 @@ void CVodesIntegrator::setMaxErrTestFails(int n)
 
 void CVodesIntegrator::setIterator(IterType t)
 {
+    int iter;
     if (t == Newton_Iter) {
-        m_iter = CV_NEWTON;
+        iter = CV_NEWTON;
     } else if (t == Functional_Iter) {
-        m_iter = CV_FUNCTIONAL;
+        iter = CV_FUNCTIONAL;
     } else {
         throw CVodesErr("unknown iterator");
     }
+    if (iter != m_iter) {
+        m_iter = iter;
+        m_recreate = true;
+    }
 }
 
 void CVodesIntegrator::sensInit(double t0, FuncEval& func)
 {
-    m_np = func.nparams();
     size_t nv = func.neq();
-    m_sens_ok = false;
+    if (m_yS) {
+        N_VDestroyVectorArray_Serial(m_yS, static_cast<int>(m_np));
+    }
+    m_np = func.nparams();
 
-    doublereal* data;
-    N_Vector y;
-    y = N_VNew_Serial(nv);
+    N_Vector y = N_VNew_Serial(nv);
     m_yS = N_VCloneVectorArray_Serial(m_np, y);
-    for (size_t n = 0; n < m_np; n++) {
-        data = NV_DATA_S(m_yS[n]);
-        for (size_t j = 0; j < nv; j++) {
-            data[j] =0.0;
-        }
-    }
+    N_VDestroy_Serial(y);
+    resetSensitivities();
 
-    int flag = CVodeSensInit(m_cvode_mem, m_np, CV_STAGGERED,
-                             CVSensRhsFn(0), m_yS);
+    // Use the sensitivity equations provided by 'func' if possible.
+    // Otherwise, CVODES evaluates them using finite differences.
+    m_sensEquations = func.hasSensitivityEquations();
+    CVSensRhsFn sensrhs = 0;
+    if (m_sensEquations) {
+        sensrhs = cvodes_sensrhs;
+    }
+    int flag = CVodeSensInit(m_cvode_mem, m_np, CV_STAGGERED, sensrhs, m_yS);
 
     if (flag != CV_SUCCESS) {
         throw CVodesErr("Error in CVodeSensMalloc");
     }
-    vector_fp atol(m_np, m_abstolsens);
-    double rtol = m_reltolsens;
-    flag = CVodeSensSStolerances(m_cvode_mem, rtol, DATA_PTR(atol));
+}
 
+void CVodesIntegrator::resetSensitivities()
+{
+    m_sens_ok = false;
+    for (size_t n = 0; n < m_np; n++) {
+        N_VConst(0.0, m_yS[n]);
+    }
 }
 
 void CVodesIntegrator::initialize(double t0, FuncEval& func)
 {
+    // If the problem has the same size and the same solver options, keep the
+    // existing CVODES memory, vectors and linear solver, and only reset the
+    // state and the tolerances. CVodeSensReInit can't change the function
+    // used for the sensitivity equations.
+    if (m_cvode_mem && !m_recreate && m_fdata->m_func == &func &&
+        func.neq() == m_neq && func.nparams() == m_np &&
+        (m_np == 0 || func.hasSensitivityEquations() == m_sensEquations)) {
+        reinitialize(t0, func);
+        return;
+    }
+
     m_neq = func.neq();
     m_t0  = t0;
     m_time = t0;
@@ -282,8 +355,16 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     func.getInitialConditions(m_t0, m_neq, NV_DATA_S(m_y));
 
     if (m_cvode_mem) {
+        if (m_np > 0) {
+            CVodeSensFree(m_cvode_mem);
+        }
         CVodeFree(&m_cvode_mem);
     }
+    if (m_yS) {
+        N_VDestroyVectorArray_Serial(m_yS, static_cast<int>(m_np));
+        m_yS = 0;
+    }
+    m_np = 0;
 
     /*
      *  Specify the method and the iteration type:
@@ -308,21 +389,6 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     }
     CVodeSetErrHandlerFn(m_cvode_mem, &cvodes_err, this);
 
-    if (m_itol == CV_SV) {
-        flag = CVodeSVtolerances(m_cvode_mem, m_reltol, m_abstol);
-    } else {
-        flag = CVodeSStolerances(m_cvode_mem, m_reltol, m_abstols);
-    }
-    if (flag != CV_SUCCESS) {
-        if (flag == CV_MEM_FAIL) {
-            throw CVodesErr("Memory allocation failed.");
-        } else if (flag == CV_ILL_INPUT) {
-            throw CVodesErr("Illegal value for CVodeInit input argument.");
-        } else {
-            throw CVodesErr("CVodeInit failed.");
-        }
-    }
-
     // pass a pointer to func in m_data
     delete m_fdata;
     m_fdata = new FuncData(&func, func.nparams());
@@ -336,10 +402,12 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
         flag = CVodeSetSensParams(m_cvode_mem, DATA_PTR(m_fdata->m_pars),
                                   NULL, NULL);
     }
+    applyTolerances();
+    setLinearSolver();
     applyOptions();
+    m_recreate = false;
 }
 
-
 void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 {
     m_t0  = t0;
@@ -352,10 +420,47 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     if (result != CV_SUCCESS) {
         throw CVodesErr("CVodeReInit failed. result = "+int2str(result));
     }
+    if (m_np > 0) {
+        resetSensitivities();
+        result = CVodeSensReInit(m_cvode_mem, CV_STAGGERED, m_yS);
+        if (result != CV_SUCCESS) {
+            throw CVodesErr("CVodeSensReInit failed. result = " +
+                            int2str(result));
+        }
+    }
+    applyTolerances();
     applyOptions();
 }
 
-void CVodesIntegrator::applyOptions()
+void CVodesIntegrator::applyTolerances()
+{
+    int flag;
+    if (m_itol == CV_SV) {
+        if (m_nabs < m_neq) {
+            throw CVodesErr("not enough absolute tolerance values specified.");
+        }
+        // CVODES copies the tolerances into a vector which it allocates only
+        // the first time
+        flag = CVodeSVtolerances(m_cvode_mem, m_reltol, m_abstol);
+    } else {
+        flag = CVodeSStolerances(m_cvode_mem, m_reltol, m_abstols);
+    }
+    if (flag != CV_SUCCESS) {
+        if (flag == CV_MEM_FAIL) {
+            throw CVodesErr("Memory allocation failed.");
+        } else if (flag == CV_ILL_INPUT) {
+            throw CVodesErr("Illegal value for CVodeInit input argument.");
+        } else {
+            throw CVodesErr("CVodeInit failed.");
+        }
+    }
+    if (m_np > 0) {
+        vector_fp atol(m_np, m_abstolsens);
+        CVodeSensSStolerances(m_cvode_mem, m_reltolsens, DATA_PTR(atol));
+    }
+}
+
+void CVodesIntegrator::setLinearSolver()
 {
     if (m_type == DENSE + NOJAC) {
         long int N = m_neq;
@@ -380,9 +485,16 @@ void CVodesIntegrator::applyOptions()
     } else {
         throw CVodesErr("unsupported option");
     }
+}
 
+void CVodesIntegrator::applyOptions()
+{
     if (m_maxord > 0) {
-        CVodeSetMaxOrd(m_cvode_mem, m_maxord);
+        int flag = CVodeSetMaxOrd(m_cvode_mem, m_maxord);
+        if (flag != CV_SUCCESS) {
+            throw CVodesErr("CVodeSetMaxOrd failed. Error code: " +
+                            int2str(flag) + "\n" + m_error_message);
+        }
     }
     if (m_maxsteps > 0) {
         CVodeSetMaxNumSteps(m_cvode_mem, m_maxsteps);
@@ -420,6 +532,25 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+void CVodesIntegrator::getDenseOutput(double t, int k, double* dky)
+{
+    N_Vector v = N_VMake_Serial(m_neq, dky);
+    int flag = CVodeGetDky(m_cvode_mem, t, k, v);
+    N_VDestroy_Serial(v);
+    if (flag != CV_SUCCESS) {
+        throw CVodesErr("CVodeGetDky failed for t = " + fp2str(t) +
+                        ", k = " + int2str(k) + ". Error code: " +
+                        int2str(flag));
+    }
+}
+
+double CVodesIntegrator::internalTime()
+{
+    realtype t;
+    CVodeGetCurrentTime(m_cvode_mem, &t);
+    return t;
+}
+
 int CVodesIntegrator::nEvals() const
 {
     long int ne;
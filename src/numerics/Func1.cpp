@@ -90,11 +90,6 @@ bool Func1::isIdentical(Func1& other) const
 }
 
 //! accessor function for the returned constant
-doublereal Func1::c() const
-{
-    return m_c;
-}
-
 // Function to set the stored constant
 void Func1::setC(doublereal c)
 {
@@ -137,6 +132,123 @@ void Func1::setParent(Func1* p)
     m_parent = p;
 }
 
+void Func1::compile(CompiledFunc1& code) const
+{
+    code.addInstruction(CompiledFunc1::Call, this);
+}
+
+/*****************************************************************************/
+
+const size_t CompiledFunc1::MaxDepth;
+
+void CompiledFunc1::compile(const Func1& f)
+{
+    clear();
+    m_depth = m_maxDepth = 1;
+    f.compile(*this);
+    if (m_maxDepth > MaxDepth) {
+        clear();
+        m_depth = m_maxDepth = 1;
+        addInstruction(Call, &f);
+    }
+}
+
+void CompiledFunc1::clear()
+{
+    m_code.clear();
+    m_depth = 0;
+    m_maxDepth = 0;
+}
+
+void CompiledFunc1::addInstruction(OpCode op, const Func1* f)
+{
+    Instruction inst;
+    inst.op = op;
+    inst.func = f;
+    m_code.push_back(inst);
+    if (op == Dup) {
+        m_depth++;
+        m_maxDepth = std::max(m_depth, m_maxDepth);
+    } else if (op == Add || op == Sub || op == Mul || op == Div) {
+        m_depth--;
+    }
+}
+
+void CompiledFunc1::addBinary(const Func1& f1, const Func1& f2, OpCode op)
+{
+    addInstruction(Dup);
+    f1.compile(*this);
+    addInstruction(Swap);
+    f2.compile(*this);
+    addInstruction(op);
+}
+
+doublereal CompiledFunc1::eval(doublereal t) const
+{
+    doublereal stack[MaxDepth];
+    size_t n = 0; // index of the top of the stack
+    stack[0] = t;
+    for (size_t i = 0; i < m_code.size(); i++) {
+        const Instruction& inst = m_code[i];
+        doublereal& x = stack[n];
+        switch (inst.op) {
+        case Call:
+            x = inst.func->eval(x);
+            break;
+        case Dup:
+            stack[n+1] = x;
+            n++;
+            break;
+        case Swap:
+            std::swap(stack[n-1], x);
+            break;
+        case Add:
+            stack[n-1] = stack[n-1] + x;
+            n--;
+            break;
+        case Sub:
+            stack[n-1] = stack[n-1] - x;
+            n--;
+            break;
+        case Mul:
+            stack[n-1] = stack[n-1] * x;
+            n--;
+            break;
+        case Div:
+            stack[n-1] = stack[n-1] / x;
+            n--;
+            break;
+        case AddConst:
+            x = x + inst.func->c();
+            break;
+        case MulConst:
+            x = x * inst.func->c();
+            break;
+        case Const:
+            x = inst.func->c();
+            break;
+        case Sin:
+            x = sin(inst.func->c() * x);
+            break;
+        case Cos:
+            x = cos(inst.func->c() * x);
+            break;
+        case Exp:
+            x = exp(inst.func->c() * x);
+            break;
+        case Pow:
+            x = pow(x, inst.func->c());
+            break;
+        case Periodic: {
+            doublereal c = inst.func->c();
+            x = x - int(x / c) * c;
+            break;
+        }
+        }
+    }
+    return stack[0];
+}
+
 /*****************************************************************************/
 
 string Sin1::write(const string& arg) const
@@ -5,6 +5,7 @@
 // Copyright 2006  California Institute of Technology
 
 #include "cantera/numerics/IDA_Solver.h"
+#include "cantera/numerics/SparseJacobian.h"
 #include "cantera/base/stringUtils.h"
 
 #if HAS_SUNDIALS
@@ -112,6 +113,41 @@ extern "C" {
         f->evalJacobianDP(t, delta_t, c_j,  ydata, ydotdata, colPts, rdata);
         return 0;
     }
+
+    //! Function called by IDA to compute the preconditioner for the iterative
+    //! linear solver, given y and ydot.
+    /*!
+     * typedef int (*IDASpilsPrecSetupFn)(realtype tt, N_Vector yy,
+     *                                    N_Vector yp, N_Vector rr,
+     *                                    realtype c_j, void *user_data,
+     *                                    N_Vector tmp1, N_Vector tmp2,
+     *                                    N_Vector tmp3);
+     *
+     * The return value has the same meaning as for ida_jacobian.
+     */
+    static int ida_psetup(realtype t, N_Vector y, N_Vector ydot, N_Vector r,
+                          realtype c_j, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        Cantera::ResidData* d = (Cantera::ResidData*) f_data;
+        return d->m_solver->setupPreconditioner(t, y, ydot, r, c_j, tmp1, tmp2);
+    }
+
+    //! Function called by IDA to solve the preconditioner system P z = r.
+    /*!
+     * typedef int (*IDASpilsPrecSolveFn)(realtype tt, N_Vector yy,
+     *                                    N_Vector yp, N_Vector rr,
+     *                                    N_Vector rvec, N_Vector zvec,
+     *                                    realtype c_j, realtype delta,
+     *                                    void *user_data, N_Vector tmp);
+     */
+    static int ida_psolve(realtype t, N_Vector y, N_Vector ydot, N_Vector r,
+                          N_Vector rvec, N_Vector zvec, realtype c_j,
+                          realtype delta, void* f_data, N_Vector tmp)
+    {
+        Cantera::ResidData* d = (Cantera::ResidData*) f_data;
+        return d->m_solver->solvePreconditioner(rvec, zvec);
+    }
 }
 
 namespace Cantera
@@ -149,7 +185,9 @@ IDA_Solver::IDA_Solver(ResidJacEval& f) :
     m_setSuppressAlg(0),
     m_fdata(0),
     m_mupper(0),
-    m_mlower(0)
+    m_mlower(0),
+    m_sparseJac(0),
+    m_maxKrylov(0)
 {
 }
 
@@ -241,6 +279,65 @@ void IDA_Solver::setBandedLinearSolver(int m_upper, int m_lower)
     m_mlower = m_lower;
 }
 
+void IDA_Solver::setSparseLinearSolver(SparseJacobian& jac, int maxKrylov)
+{
+    if ((int) jac.nRows() != m_neq) {
+        throw IDA_Err("setSparseLinearSolver: Jacobian has " +
+                      int2str(jac.nRows()) + " rows, but the problem has " +
+                      int2str(m_neq) + " equations");
+    }
+    m_type = 3;
+    m_sparseJac = &jac;
+    m_maxKrylov = maxKrylov;
+    m_dy.resize(m_neq);
+}
+
+int IDA_Solver::setupPreconditioner(doublereal t, N_Vector y, N_Vector ydot,
+                                    N_Vector r, doublereal cj,
+                                    N_Vector tmp1, N_Vector tmp2)
+{
+    SparseJacobian& J = *m_sparseJac;
+    const doublereal* yy = NV_DATA_S(y);
+    const doublereal* yyp = NV_DATA_S(ydot);
+    const doublereal* rr = NV_DATA_S(r);
+    doublereal* rp = NV_DATA_S(tmp2);
+    doublereal delta_t = getCurrentStepFromIDA();
+
+    if (m_formJac == 1) {
+        int flag = m_resid.evalJacobianSparse(t, delta_t, cj, yy, yyp, J, rp);
+        if (flag < 0) {
+            return flag;
+        }
+    } else {
+        // Base the perturbations on the error weights, which IDA sets to
+        // 1/(rtol*|y_i| + atol_i)
+        IDAGetErrWeights(m_ida_mem, tmp1);
+        doublereal* w = NV_DATA_S(tmp1);
+        for (int i = 0; i < m_neq; i++) {
+            w[i] = 1.0 / w[i];
+        }
+        m_resid.calcDeltaSolnVariables(t, yy, yyp, &m_dy[0], w);
+        int flag = J.evalFiniteDifference(m_resid, t, delta_t, cj, yy, yyp, rr,
+                                          &m_dy[0]);
+        if (flag < 0) {
+            return flag;
+        }
+    }
+
+    // A zero pivot is a recoverable error, so that IDA will try again with
+    // a smaller step size.
+    return (J.factorILU() == 0) ? 0 : 1;
+}
+
+int IDA_Solver::solvePreconditioner(N_Vector r, N_Vector z)
+{
+    doublereal* zz = NV_DATA_S(z);
+    const doublereal* rr = NV_DATA_S(r);
+    std::copy(rr, rr + m_neq, zz);
+    m_sparseJac->solveILU(zz);
+    return 0;
+}
+
 void IDA_Solver::setMaxOrder(int n)
 {
     m_maxord = n;
@@ -271,7 +368,7 @@ doublereal IDA_Solver::getCurrentStepFromIDA()
 void IDA_Solver::setJacobianType(int formJac)
 {
     m_formJac = formJac;
-    if (m_ida_mem) {
+    if (m_ida_mem && m_type != 3) {
         if (m_formJac == 1) {
             int flag = IDADlsSetDenseJacFn(m_ida_mem, ida_jacobian);
             if (flag != IDA_SUCCESS) {
@@ -395,11 +492,24 @@ void IDA_Solver::init(doublereal t0)
         long int nu = m_mupper;
         long int nl = m_mlower;
         IDABand(m_ida_mem, N, nu, nl);
+    } else if (m_type == 3) {
+        if (!m_sparseJac) {
+            throw IDA_Err("No sparse Jacobian was provided for the iterative "
+                          "linear solver");
+        }
+        flag = IDASpgmr(m_ida_mem, m_maxKrylov);
+        if (flag != IDA_SUCCESS) {
+            throw IDA_Err("IDASpgmr failed");
+        }
+        flag = IDASpilsSetPreconditioner(m_ida_mem, ida_psetup, ida_psolve);
+        if (flag != IDA_SUCCESS) {
+            throw IDA_Err("IDASpilsSetPreconditioner failed");
+        }
     } else {
         throw IDA_Err("unsupported linear solver type");
     }
 
-    if (m_formJac == 1) {
+    if (m_formJac == 1 && m_type != 3) {
         flag = IDADlsSetDenseJacFn(m_ida_mem, ida_jacobian);
         if (flag != IDA_SUCCESS) {
             throw IDA_Err("IDADlsSetDenseJacFn failed.");
@@ -1,7 +1,8 @@
 //! @file ODE_integrators.cpp
 #include "cantera/base/ct_defs.h"
 #include "cantera/numerics/Integrator.h"
-
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/RungeKuttaIntegrator.h"
 
 #ifdef HAS_SUNDIALS
 #include "cantera/numerics/CVodesIntegrator.h"
@@ -20,6 +21,10 @@ Integrator* newIntegrator(const std::string& itype)
 #else
         return new CVodeInt();
 #endif
+    } else if (itype == "Rosenbrock") {
+        return new RosenbrockIntegrator();
+    } else if (itype == "RungeKutta") {
+        return new RungeKuttaIntegrator();
     } else {
         throw CanteraError("newIntegrator",
                            "unknown ODE integrator: "+itype);
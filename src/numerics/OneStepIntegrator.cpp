@@ -0,0 +1,295 @@
+//! @file OneStepIntegrator.cpp
+#include "cantera/numerics/OneStepIntegrator.h"
+#include "cantera/base/stringUtils.h"
+
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+OneStepIntegrator::OneStepIntegrator() :
+    m_func(0),
+    m_neq(0),
+    m_reltol(1.0e-9),
+    m_abstols(1.0e-15),
+    m_scalarTol(true),
+    m_tn(0.0),
+    m_told(0.0),
+    m_time(0.0),
+    m_h(0.0),
+    m_hmax(0.0),
+    m_hmin(0.0),
+    m_maxsteps(20000),
+    m_maxErrTestFails(0),
+    m_rejected(false),
+    m_nevals(0),
+    m_nsteps(0),
+    m_nrejected(0)
+{
+}
+
+void OneStepIntegrator::setTolerances(double reltol, size_t n, double* abstol)
+{
+    m_scalarTol = false;
+    m_reltol = reltol;
+    m_abstol.assign(abstol, abstol + n);
+}
+
+void OneStepIntegrator::setTolerances(double reltol, double abstol)
+{
+    m_scalarTol = true;
+    m_reltol = reltol;
+    m_abstols = abstol;
+}
+
+void OneStepIntegrator::initialize(double t0, FuncEval& func)
+{
+    if (func.nparams() > 0) {
+        throw CanteraError("OneStepIntegrator::initialize", "Sensitivity "
+                           "analysis is only supported by the CVODE integrator");
+    }
+    m_func = &func;
+    m_neq = func.neq();
+    if (m_scalarTol) {
+        m_abstol.assign(m_neq, m_abstols);
+    } else if (m_abstol.size() < m_neq) {
+        throw CanteraError("OneStepIntegrator::initialize",
+                           "not enough absolute tolerance values specified.");
+    }
+    m_weights.resize(m_neq);
+    m_yn.resize(m_neq);
+    m_fn.resize(m_neq);
+    m_yold.resize(m_neq);
+    m_fold.resize(m_neq);
+    m_ynew.resize(m_neq);
+    m_fnew.resize(m_neq);
+    m_y.resize(m_neq);
+    resize();
+    reinitialize(t0, func);
+}
+
+void OneStepIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    if (m_scalarTol) {
+        m_abstol.assign(m_neq, m_abstols);
+    }
+    m_tn = m_told = m_time = t0;
+    func.getInitialConditions(t0, m_neq, &m_yn[0]);
+    m_y = m_yn;
+    m_yold = m_yn;
+    m_nevals = 0;
+    m_nsteps = 0;
+    m_nrejected = 0;
+    m_h = 0.0;
+    m_rejected = false;
+    eval(t0, &m_yn[0], &m_fn[0]);
+    m_fold = m_fn;
+}
+
+void OneStepIntegrator::eval(double t, const double* y, double* ydot)
+{
+    // FuncEval::eval() takes a non-const pointer to the state but does not
+    // modify it
+    m_func->eval(t, const_cast<double*>(y), ydot, 0);
+    m_nevals++;
+}
+
+void OneStepIntegrator::updateWeights()
+{
+    for (size_t i = 0; i < m_neq; i++) {
+        double ymax = std::max(fabs(m_yn[i]), fabs(m_ynew[i]));
+        m_weights[i] = 1.0 / (m_abstol[i] + m_reltol * ymax);
+    }
+}
+
+double OneStepIntegrator::weightedNorm(const double* v) const
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double e = v[i] * m_weights[i];
+        sum += e * e;
+    }
+    return sqrt(sum / m_neq);
+}
+
+double OneStepIntegrator::initialStepSize(double tout)
+{
+    double q = errorOrder();
+    for (size_t i = 0; i < m_neq; i++) {
+        m_weights[i] = 1.0 / (m_abstol[i] + m_reltol * fabs(m_yn[i]));
+    }
+    double d0 = weightedNorm(&m_yn[0]);
+    double d1 = weightedNorm(&m_fn[0]);
+    double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+    double span = fabs(tout - m_tn);
+    if (span > 0.0) {
+        h0 = std::min(h0, span);
+    }
+
+    // Take an explicit Euler step to estimate the second derivative
+    for (size_t i = 0; i < m_neq; i++) {
+        m_ynew[i] = m_yn[i] + h0 * m_fn[i];
+    }
+    eval(m_tn + h0, &m_ynew[0], &m_fnew[0]);
+    for (size_t i = 0; i < m_neq; i++) {
+        m_fnew[i] -= m_fn[i];
+    }
+    double d2 = weightedNorm(&m_fnew[0]) / h0;
+    double dmax = std::max(d1, d2);
+    double h1 = (dmax <= 1e-15) ? std::max(1e-6, 1e-3 * h0)
+                                : pow(0.01 / dmax, 1.0 / (q + 1));
+    double h = std::min(100 * h0, h1);
+    if (span > 0.0) {
+        h = std::min(h, span);
+    }
+    return h;
+}
+
+void OneStepIntegrator::takeStep(double tout)
+{
+    if (m_h == 0.0) {
+        m_h = initialStepSize(tout);
+    }
+    double q = errorOrder();
+    int nfail = 0;
+    while (true) {
+        double h = m_h;
+        if (m_hmax > 0.0) {
+            h = std::min(h, m_hmax);
+        }
+        // Stretch the step to reach tout if it would otherwise fall just short
+        bool last = (m_tn + 1.01 * h >= tout);
+        if (last) {
+            h = tout - m_tn;
+        }
+        if (!last && (h < m_hmin || h <= 10 * DBL_EPSILON * fabs(m_tn))) {
+            throw CanteraError("OneStepIntegrator::takeStep",
+                               "Step size too small at t = " + fp2str(m_tn));
+        }
+
+        double err = attemptStep(h);
+        if (!(err == err)) {
+            // NaN values in the attempted step are treated as a large error
+            err = 1e10;
+        }
+        if (err <= 1.0) {
+            // The step is accepted. After a rejected step, the step size
+            // is not increased.
+            double fac = 0.9 * pow(std::max(err, 1e-10), -1.0 / (q + 1));
+            fac = std::min(fac, m_rejected ? 1.0 : 5.0);
+            fac = std::max(fac, 0.2);
+            m_told = m_tn;
+            m_tn = (last) ? tout : m_tn + h;
+            m_yold.swap(m_yn);
+            m_fold.swap(m_fn);
+            m_yn.swap(m_ynew);
+            m_fn.swap(m_fnew);
+            m_nsteps++;
+            m_rejected = false;
+            // If the step was shortened to reach tout, keep the step size
+            // that was proposed for it
+            m_h = (last) ? std::max(h * fac, m_h) : h * fac;
+            stepAccepted();
+            return;
+        }
+
+        nfail++;
+        m_nrejected++;
+        m_rejected = true;
+        if (m_maxErrTestFails > 0 && nfail >= m_maxErrTestFails) {
+            throw CanteraError("OneStepIntegrator::takeStep", "Error test "
+                               "failed " + int2str(nfail) + " times at t = " +
+                               fp2str(m_tn));
+        }
+        m_h = h * std::max(0.2, 0.9 * pow(err, -1.0 / (q + 1)));
+    }
+}
+
+void OneStepIntegrator::integrate(double tout)
+{
+    if (tout < m_told) {
+        throw CanteraError("OneStepIntegrator::integrate", "Cannot integrate "
+                           "backwards to t = " + fp2str(tout));
+    }
+    int nsteps = 0;
+    while (m_tn < tout) {
+        if (m_maxsteps > 0 && nsteps++ >= m_maxsteps) {
+            throw CanteraError("OneStepIntegrator::integrate", "Maximum "
+                               "number of steps (" + int2str(m_maxsteps) +
+                               ") taken before reaching t = " + fp2str(tout));
+        }
+        takeStep(tout);
+    }
+    m_time = tout;
+    if (tout == m_tn) {
+        m_y = m_yn;
+    } else {
+        getDenseOutput(tout, 0, &m_y[0]);
+    }
+}
+
+double OneStepIntegrator::step(double tout)
+{
+    if (tout > m_tn) {
+        takeStep(tout);
+    }
+    m_time = m_tn;
+    m_y = m_yn;
+    return m_time;
+}
+
+void OneStepIntegrator::getDenseOutput(double t, int k, double* dky)
+{
+    double h = m_tn - m_told;
+    double eps = 100 * DBL_EPSILON * std::max(fabs(m_tn), fabs(h));
+    if (t < m_told - eps || t > m_tn + eps || k < 0) {
+        throw CanteraError("OneStepIntegrator::getDenseOutput",
+                           "Invalid arguments t = " + fp2str(t) +
+                           ", k = " + int2str(k));
+    }
+    if (h == 0.0) {
+        for (size_t i = 0; i < m_neq; i++) {
+            dky[i] = (k == 0) ? m_yn[i] : (k == 1) ? m_fn[i] : 0.0;
+        }
+        return;
+    }
+
+    // Cubic Hermite basis functions of s = (t - told) / h and their
+    // derivatives with respect to t
+    double s = (t - m_told) / h;
+    double h00, h10, h01, h11;
+    if (k == 0) {
+        h00 = (1 + 2*s) * (1 - s) * (1 - s);
+        h10 = s * (1 - s) * (1 - s) * h;
+        h01 = s * s * (3 - 2*s);
+        h11 = s * s * (s - 1) * h;
+    } else if (k == 1) {
+        h00 = 6 * s * (s - 1) / h;
+        h10 = (1 - 4*s + 3*s*s);
+        h01 = -h00;
+        h11 = s * (3*s - 2);
+    } else if (k == 2) {
+        h00 = (12*s - 6) / (h * h);
+        h10 = (6*s - 4) / h;
+        h01 = -h00;
+        h11 = (6*s - 2) / h;
+    } else if (k == 3) {
+        h00 = 12 / (h * h * h);
+        h10 = 6 / (h * h);
+        h01 = -h00;
+        h11 = 6 / (h * h);
+    } else {
+        for (size_t i = 0; i < m_neq; i++) {
+            dky[i] = 0.0;
+        }
+        return;
+    }
+    for (size_t i = 0; i < m_neq; i++) {
+        dky[i] = h00 * m_yold[i] + h10 * m_fold[i] +
+                 h01 * m_yn[i] + h11 * m_fn[i];
+    }
+}
+
+}
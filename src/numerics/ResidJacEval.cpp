@@ -186,4 +186,13 @@ int ResidJacEval::evalJacobianDP(const doublereal t, const doublereal delta_t,
     return 1;
 }
 
+int ResidJacEval::evalJacobianSparse(const doublereal t, const doublereal delta_t,
+                                     doublereal cj, const doublereal* const y,
+                                     const doublereal* const ydot,
+                                     SparseJacobian& J, doublereal* const resid)
+{
+    throw CanteraError("ResidJacEval::evalJacobianSparse()", "Not implemented\n");
+    return 1;
+}
+
 }
@@ -0,0 +1,193 @@
+//! @file RosenbrockIntegrator.cpp
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/ctlapack.h"
+#include "cantera/base/stringUtils.h"
+
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+// Coefficients of the RODAS3 method of Sandu et al., Atmos. Environ.
+// 31:3459-3472, 1997. The stage coefficients A and C are stored row by row,
+// so that A[i*(i-1)/2 + j] is the coefficient a_ij, for j < i.
+const size_t NSTAGES = 4;
+const double A[6] = {0.0, 2.0, 0.0, 2.0, 0.0, 1.0};
+const double C[6] = {4.0, 1.0, -1.0, 1.0, -1.0, -8.0/3.0};
+// Whether the right-hand side is evaluated for each stage. Otherwise, the
+// value from the previous stage is used.
+const bool NEWF[4] = {true, false, true, true};
+const double M[4] = {2.0, 0.0, 1.0, 1.0};
+const double E[4] = {0.0, 0.0, 0.0, 1.0};
+const double ALPHA[4] = {0.0, 0.0, 1.0, 1.0};
+const double GAMMA[4] = {0.5, 1.5, 0.0, 0.0};
+
+}
+
+RosenbrockIntegrator::RosenbrockIntegrator() :
+    m_analyticJac(false),
+    m_jacCurrent(false),
+    m_njac(0)
+{
+}
+
+void RosenbrockIntegrator::setProblemType(int probtype)
+{
+    if (probtype == DENSE + NOJAC) {
+        m_analyticJac = false;
+    } else if (probtype == DENSE + JAC) {
+        m_analyticJac = true;
+    } else {
+        throw CanteraError("RosenbrockIntegrator::setProblemType",
+                           "unsupported problem type: " + int2str(probtype));
+    }
+}
+
+void RosenbrockIntegrator::initialize(double t0, FuncEval& func)
+{
+    if (m_analyticJac && !func.hasJacobian()) {
+        throw CanteraError("RosenbrockIntegrator::initialize",
+                           "An analytic Jacobian was requested, but is not "
+                           "provided by the function");
+    }
+    OneStepIntegrator::initialize(t0, func);
+}
+
+void RosenbrockIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    OneStepIntegrator::reinitialize(t0, func);
+    m_jacCurrent = false;
+    m_njac = 0;
+}
+
+void RosenbrockIntegrator::resize()
+{
+    m_jac.resize(m_neq * m_neq);
+    m_dfdt.resize(m_neq);
+    m_lu.resize(m_neq, m_neq);
+    m_K.resize(NSTAGES * m_neq);
+    m_work.resize(m_neq);
+}
+
+void RosenbrockIntegrator::evalJacobian(double h)
+{
+    double sqrteps = sqrt(DBL_EPSILON);
+    if (m_analyticJac) {
+        m_func->evalJacobian(m_tn, &m_yn[0], &m_fn[0], &m_jac[0]);
+    } else {
+        m_work = m_yn;
+        double rtol = std::max(m_reltol, DBL_EPSILON);
+        for (size_t j = 0; j < m_neq; j++) {
+            double ysave = m_work[j];
+            m_work[j] += sqrteps * std::max(fabs(ysave), m_abstol[j] / rtol);
+            double dy = m_work[j] - ysave;
+            eval(m_tn, &m_work[0], &m_fnew[0]);
+            double* col = &m_jac[j * m_neq];
+            for (size_t i = 0; i < m_neq; i++) {
+                col[i] = (m_fnew[i] - m_fn[i]) / dy;
+            }
+            m_work[j] = ysave;
+        }
+    }
+
+    double dt = sqrteps * std::max(fabs(m_tn), h);
+    eval(m_tn + dt, &m_yn[0], &m_fnew[0]);
+    for (size_t i = 0; i < m_neq; i++) {
+        m_dfdt[i] = (m_fnew[i] - m_fn[i]) / dt;
+    }
+    m_jacCurrent = true;
+    m_njac++;
+}
+
+void RosenbrockIntegrator::solve(double* b)
+{
+    int info = 0;
+    ct_dgetrs(ctlapack::NoTranspose, m_neq, 1, m_lu.ptrColumn(0), m_neq,
+              DATA_PTR(m_lu.ipiv()), b, m_neq, info);
+    if (info != 0) {
+        throw CanteraError("RosenbrockIntegrator::solve",
+                           "DGETRS returned INFO = " + int2str(info));
+    }
+}
+
+double RosenbrockIntegrator::attemptStep(double h)
+{
+    if (!m_jacCurrent) {
+        evalJacobian(h);
+    }
+
+    // Form and factorize the matrix (1/(gamma h) I - J)
+    double* a = m_lu.ptrColumn(0);
+    for (size_t k = 0; k < m_neq * m_neq; k++) {
+        a[k] = -m_jac[k];
+    }
+    for (size_t i = 0; i < m_neq; i++) {
+        m_lu(i,i) += 1.0 / (GAMMA[0] * h);
+    }
+    int info = 0;
+    ct_dgetrf(m_neq, m_neq, a, m_neq, DATA_PTR(m_lu.ipiv()), info);
+    if (info != 0) {
+        // A singular matrix is treated like a failed error test, so that
+        // the step size is reduced
+        return 1e10;
+    }
+
+    double* ynew = &m_ynew[0];
+    double* f = &m_fnew[0];
+    for (size_t s = 0; s < NSTAGES; s++) {
+        double* K = &m_K[s * m_neq];
+        size_t offset = s * (s - 1) / 2;
+        if (s == 0) {
+            std::copy(m_fn.begin(), m_fn.end(), f);
+        } else if (NEWF[s]) {
+            for (size_t i = 0; i < m_neq; i++) {
+                ynew[i] = m_yn[i];
+            }
+            for (size_t j = 0; j < s; j++) {
+                double aij = A[offset + j];
+                if (aij != 0.0) {
+                    const double* Kj = &m_K[j * m_neq];
+                    for (size_t i = 0; i < m_neq; i++) {
+                        ynew[i] += aij * Kj[i];
+                    }
+                }
+            }
+            eval(m_tn + ALPHA[s] * h, ynew, f);
+        }
+        for (size_t i = 0; i < m_neq; i++) {
+            K[i] = f[i] + GAMMA[s] * h * m_dfdt[i];
+        }
+        for (size_t j = 0; j < s; j++) {
+            double cij = C[offset + j] / h;
+            const double* Kj = &m_K[j * m_neq];
+            for (size_t i = 0; i < m_neq; i++) {
+                K[i] += cij * Kj[i];
+            }
+        }
+        solve(K);
+    }
+
+    for (size_t i = 0; i < m_neq; i++) {
+        ynew[i] = m_yn[i];
+        m_work[i] = 0.0;
+    }
+    for (size_t s = 0; s < NSTAGES; s++) {
+        const double* K = &m_K[s * m_neq];
+        for (size_t i = 0; i < m_neq; i++) {
+            ynew[i] += M[s] * K[i];
+            m_work[i] += E[s] * K[i];
+        }
+    }
+    updateWeights();
+    double err = weightedNorm(&m_work[0]);
+    if (err <= 1.0) {
+        eval(m_tn + h, ynew, f);
+    }
+    return err;
+}
+
+}
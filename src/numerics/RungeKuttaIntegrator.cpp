@@ -0,0 +1,152 @@
+//! @file RungeKuttaIntegrator.cpp
+#include "cantera/numerics/RungeKuttaIntegrator.h"
+#include "cantera/base/stringUtils.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace {
+
+// Coefficients of the Dormand-Prince 5(4) method
+const double C2 = 1.0/5.0;
+const double C3 = 3.0/10.0;
+const double C4 = 4.0/5.0;
+const double C5 = 8.0/9.0;
+const double A21 = 1.0/5.0;
+const double A31 = 3.0/40.0;
+const double A32 = 9.0/40.0;
+const double A41 = 44.0/45.0;
+const double A42 = -56.0/15.0;
+const double A43 = 32.0/9.0;
+const double A51 = 19372.0/6561.0;
+const double A52 = -25360.0/2187.0;
+const double A53 = 64448.0/6561.0;
+const double A54 = -212.0/729.0;
+const double A61 = 9017.0/3168.0;
+const double A62 = -355.0/33.0;
+const double A63 = 46732.0/5247.0;
+const double A64 = 49.0/176.0;
+const double A65 = -5103.0/18656.0;
+const double A71 = 35.0/384.0;
+const double A73 = 500.0/1113.0;
+const double A74 = 125.0/192.0;
+const double A75 = -2187.0/6784.0;
+const double A76 = 11.0/84.0;
+const double E1 = 71.0/57600.0;
+const double E3 = -71.0/16695.0;
+const double E4 = 71.0/1920.0;
+const double E5 = -17253.0/339200.0;
+const double E6 = 22.0/525.0;
+const double E7 = -1.0/40.0;
+
+}
+
+RungeKuttaIntegrator::RungeKuttaIntegrator() :
+    m_hlast(0.0),
+    m_maxStiffSteps(15),
+    m_nstiff(0),
+    m_nonstiff(0)
+{
+}
+
+void RungeKuttaIntegrator::reinitialize(double t0, FuncEval& func)
+{
+    OneStepIntegrator::reinitialize(t0, func);
+    m_nstiff = 0;
+    m_nonstiff = 0;
+}
+
+void RungeKuttaIntegrator::resize()
+{
+    m_k2.resize(m_neq);
+    m_k3.resize(m_neq);
+    m_k4.resize(m_neq);
+    m_k5.resize(m_neq);
+    m_k6.resize(m_neq);
+    m_ystiff.resize(m_neq);
+    m_work.resize(m_neq);
+}
+
+double RungeKuttaIntegrator::attemptStep(double h)
+{
+    m_hlast = h;
+    const double* y = &m_yn[0];
+    const double* k1 = &m_fn[0];
+    double* k2 = &m_k2[0];
+    double* k3 = &m_k3[0];
+    double* k4 = &m_k4[0];
+    double* k5 = &m_k5[0];
+    double* k6 = &m_k6[0];
+    double* k7 = &m_fnew[0];
+    double* ys = &m_ystiff[0];
+    double* ynew = &m_ynew[0];
+    size_t n = m_neq;
+
+    for (size_t i = 0; i < n; i++) {
+        ynew[i] = y[i] + h * A21 * k1[i];
+    }
+    eval(m_tn + C2 * h, ynew, k2);
+    for (size_t i = 0; i < n; i++) {
+        ynew[i] = y[i] + h * (A31 * k1[i] + A32 * k2[i]);
+    }
+    eval(m_tn + C3 * h, ynew, k3);
+    for (size_t i = 0; i < n; i++) {
+        ynew[i] = y[i] + h * (A41 * k1[i] + A42 * k2[i] + A43 * k3[i]);
+    }
+    eval(m_tn + C4 * h, ynew, k4);
+    for (size_t i = 0; i < n; i++) {
+        ynew[i] = y[i] + h * (A51 * k1[i] + A52 * k2[i] + A53 * k3[i] +
+                              A54 * k4[i]);
+    }
+    eval(m_tn + C5 * h, ynew, k5);
+    for (size_t i = 0; i < n; i++) {
+        ys[i] = y[i] + h * (A61 * k1[i] + A62 * k2[i] + A63 * k3[i] +
+                            A64 * k4[i] + A65 * k5[i]);
+    }
+    eval(m_tn + h, ys, k6);
+    for (size_t i = 0; i < n; i++) {
+        ynew[i] = y[i] + h * (A71 * k1[i] + A73 * k3[i] + A74 * k4[i] +
+                              A75 * k5[i] + A76 * k6[i]);
+    }
+    eval(m_tn + h, ynew, k7);
+
+    for (size_t i = 0; i < n; i++) {
+        m_work[i] = h * (E1 * k1[i] + E3 * k3[i] + E4 * k4[i] + E5 * k5[i] +
+                         E6 * k6[i] + E7 * k7[i]);
+    }
+    updateWeights();
+    return weightedNorm(&m_work[0]);
+}
+
+void RungeKuttaIntegrator::stepAccepted()
+{
+    if (m_maxStiffSteps <= 0) {
+        return;
+    }
+    // Estimate h*lambda from the last two stages, which are evaluated at the
+    // same time. After the step, the last stage is stored in m_fn.
+    double num = 0.0;
+    double den = 0.0;
+    for (size_t i = 0; i < m_neq; i++) {
+        double df = m_fn[i] - m_k6[i];
+        double dy = m_yn[i] - m_ystiff[i];
+        num += df * df;
+        den += dy * dy;
+    }
+    if (den > 0.0 && m_hlast * m_hlast * num > 3.25 * 3.25 * den) {
+        m_nonstiff = 0;
+        m_nstiff++;
+        if (m_nstiff >= m_maxStiffSteps) {
+            throw CanteraError("RungeKuttaIntegrator::stepAccepted",
+                               "The problem appears to be stiff at t = " +
+                               fp2str(m_tn) + ". Use an implicit integrator "
+                               "instead.");
+        }
+    } else if (++m_nonstiff == 6) {
+        m_nstiff = 0;
+    }
+}
+
+}
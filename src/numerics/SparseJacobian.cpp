@@ -0,0 +1,235 @@
+/**
+ *  @file SparseJacobian.cpp
+ */
+
+#include "cantera/numerics/SparseJacobian.h"
+#include "cantera/numerics/ResidJacEval.h"
+#include "cantera/base/stringUtils.h"
+
+#include <algorithm>
+
+namespace Cantera
+{
+
+SparseJacobian::SparseJacobian(size_t n, const vector_int& rowStart,
+                               const vector_int& colIndex) :
+    m_n(n),
+    m_ncolors(0)
+{
+    if (rowStart.size() != n + 1) {
+        throw CanteraError("SparseJacobian::SparseJacobian",
+                           "rowStart must have length n+1 = " + int2str(n+1));
+    }
+    if (rowStart[n] > (int) colIndex.size()) {
+        throw CanteraError("SparseJacobian::SparseJacobian",
+                           "colIndex has fewer than " + int2str(rowStart[n]) +
+                           " elements");
+    }
+
+    // Sort the columns in each row, and add the diagonal element if it is
+    // missing
+    m_rowStart.resize(n + 1);
+    m_diag.resize(n);
+    vector_int cols;
+    for (size_t i = 0; i < n; i++) {
+        m_rowStart[i] = (int) m_colIndex.size();
+        cols.assign(colIndex.begin() + rowStart[i],
+                    colIndex.begin() + rowStart[i+1]);
+        cols.push_back((int) i);
+        std::sort(cols.begin(), cols.end());
+        cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+        if (cols.front() < 0 || cols.back() >= (int) n) {
+            throw CanteraError("SparseJacobian::SparseJacobian",
+                               "column index out of range in row " +
+                               int2str(i));
+        }
+        for (size_t k = 0; k < cols.size(); k++) {
+            if (cols[k] == (int) i) {
+                m_diag[i] = (int) m_colIndex.size();
+            }
+            m_colIndex.push_back(cols[k]);
+        }
+    }
+    m_rowStart[n] = (int) m_colIndex.size();
+    m_values.assign(m_colIndex.size(), 0.0);
+    m_lu.assign(m_colIndex.size(), 0.0);
+    m_work.assign(n, -1);
+    computeColoring();
+}
+
+int SparseJacobian::index(size_t i, size_t j) const
+{
+    vector_int::const_iterator begin = m_colIndex.begin() + m_rowStart[i];
+    vector_int::const_iterator end = m_colIndex.begin() + m_rowStart[i+1];
+    vector_int::const_iterator loc = std::lower_bound(begin, end, (int) j);
+    if (loc == end || *loc != (int) j) {
+        return -1;
+    }
+    return (int) (loc - m_colIndex.begin());
+}
+
+doublereal& SparseJacobian::operator()(size_t i, size_t j)
+{
+    int k = index(i, j);
+    if (k < 0) {
+        throw CanteraError("SparseJacobian::operator()",
+                           "Element (" + int2str(i) + ", " + int2str(j) +
+                           ") is not in the nonzero pattern");
+    }
+    return m_values[k];
+}
+
+doublereal SparseJacobian::operator()(size_t i, size_t j) const
+{
+    int k = index(i, j);
+    return (k < 0) ? 0.0 : m_values[k];
+}
+
+void SparseJacobian::zero()
+{
+    std::fill(m_values.begin(), m_values.end(), 0.0);
+}
+
+void SparseJacobian::mult(const doublereal* b, doublereal* prod) const
+{
+    for (size_t i = 0; i < m_n; i++) {
+        double sum = 0.0;
+        for (int k = m_rowStart[i]; k < m_rowStart[i+1]; k++) {
+            sum += m_values[k] * b[m_colIndex[k]];
+        }
+        prod[i] = sum;
+    }
+}
+
+void SparseJacobian::computeColoring()
+{
+    m_colRows.assign(m_n, vector_int());
+    m_colElements.assign(m_n, vector_int());
+    for (size_t i = 0; i < m_n; i++) {
+        for (int k = m_rowStart[i]; k < m_rowStart[i+1]; k++) {
+            m_colRows[m_colIndex[k]].push_back((int) i);
+            m_colElements[m_colIndex[k]].push_back(k);
+        }
+    }
+
+    // Greedy coloring: each column gets the lowest color not already used by
+    // a column that has a nonzero element in one of the same rows.
+    m_color.assign(m_n, -1);
+    m_ncolors = 0;
+    vector_int usedBy(m_n, -1);
+    for (size_t j = 0; j < m_n; j++) {
+        const vector_int& rows = m_colRows[j];
+        for (size_t r = 0; r < rows.size(); r++) {
+            int i = rows[r];
+            for (int k = m_rowStart[i]; k < m_rowStart[i+1]; k++) {
+                int c = m_color[m_colIndex[k]];
+                if (c >= 0) {
+                    usedBy[c] = (int) j;
+                }
+            }
+        }
+        int c = 0;
+        while (usedBy[c] == (int) j) {
+            c++;
+        }
+        m_color[j] = c;
+        m_ncolors = std::max(m_ncolors, (size_t) c + 1);
+    }
+}
+
+int SparseJacobian::evalFiniteDifference(ResidJacEval& func, doublereal t,
+                                         doublereal delta_t, doublereal cj,
+                                         const doublereal* y,
+                                         const doublereal* ydot,
+                                         const doublereal* resid,
+                                         const doublereal* dy)
+{
+    m_ywork.assign(y, y + m_n);
+    m_ydotwork.assign(ydot, ydot + m_n);
+    m_rwork.resize(m_n);
+
+    // Columns with the same color don't share any rows, so they are
+    // perturbed together and their elements are found from a single
+    // residual evaluation.
+    for (int c = 0; c < (int) m_ncolors; c++) {
+        for (size_t j = 0; j < m_n; j++) {
+            if (m_color[j] == c) {
+                m_ywork[j] += dy[j];
+                m_ydotwork[j] += cj * dy[j];
+            }
+        }
+        int flag = func.evalResidNJ(t, delta_t, &m_ywork[0], &m_ydotwork[0],
+                                    &m_rwork[0], JacDelta_ResidEval);
+        if (flag < 0) {
+            return flag;
+        }
+        for (size_t j = 0; j < m_n; j++) {
+            if (m_color[j] == c) {
+                const vector_int& rows = m_colRows[j];
+                const vector_int& elements = m_colElements[j];
+                for (size_t k = 0; k < rows.size(); k++) {
+                    m_values[elements[k]] =
+                        (m_rwork[rows[k]] - resid[rows[k]]) / dy[j];
+                }
+                m_ywork[j] = y[j];
+                m_ydotwork[j] = ydot[j];
+            }
+        }
+    }
+    return 0;
+}
+
+int SparseJacobian::factorILU()
+{
+    m_lu = m_values;
+    for (size_t i = 0; i < m_n; i++) {
+        int rowBegin = m_rowStart[i];
+        int rowEnd = m_rowStart[i+1];
+        for (int k = rowBegin; k < rowEnd; k++) {
+            m_work[m_colIndex[k]] = k;
+        }
+        // Eliminate the elements to the left of the diagonal, using the
+        // rows above, which have already been factored. Fill-in outside the
+        // nonzero pattern is dropped.
+        for (int k = rowBegin; k < m_diag[i]; k++) {
+            int r = m_colIndex[k];
+            m_lu[k] /= m_lu[m_diag[r]];
+            double l = m_lu[k];
+            for (int kk = m_diag[r] + 1; kk < m_rowStart[r+1]; kk++) {
+                int loc = m_work[m_colIndex[kk]];
+                if (loc >= 0) {
+                    m_lu[loc] -= l * m_lu[kk];
+                }
+            }
+        }
+        for (int k = rowBegin; k < rowEnd; k++) {
+            m_work[m_colIndex[k]] = -1;
+        }
+        if (m_lu[m_diag[i]] == 0.0) {
+            return (int) i + 1;
+        }
+    }
+    return 0;
+}
+
+void SparseJacobian::solveILU(doublereal* b) const
+{
+    // Forward substitution with the unit lower triangular factor
+    for (size_t i = 0; i < m_n; i++) {
+        double sum = b[i];
+        for (int k = m_rowStart[i]; k < m_diag[i]; k++) {
+            sum -= m_lu[k] * b[m_colIndex[k]];
+        }
+        b[i] = sum;
+    }
+    // Back substitution with the upper triangular factor
+    for (size_t i = m_n; i-- > 0;) {
+        double sum = b[i];
+        for (int k = m_diag[i] + 1; k < m_rowStart[i+1]; k++) {
+            sum -= m_lu[k] * b[m_colIndex[k]];
+        }
+        b[i] = sum / m_lu[m_diag[i]];
+    }
+}
+
+}
@@ -24,6 +24,7 @@
 #include "cantera/thermo/electrolytes.h"
 #include "cantera/base/stringUtils.h"
 #include <cstdio>
+#include <algorithm>
 
 namespace Cantera
 {
@@ -322,6 +323,16 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         m_molalitiesCropped    = b.m_molalitiesCropped;
         m_molalitiesAreCropped = b.m_molalitiesAreCropped;
         m_CounterIJ            = b.m_CounterIJ;
+        m_CationAnionPairs     = b.m_CationAnionPairs;
+        m_LikeChargePairs      = b.m_LikeChargePairs;
+        m_ChargedPairs         = b.m_ChargedPairs;
+        m_CMXPartners          = b.m_CMXPartners;
+        m_CMXStart             = b.m_CMXStart;
+        m_PsiIndex             = b.m_PsiIndex;
+        m_PsiK_ij              = b.m_PsiK_ij;
+        m_PsiStart_ij          = b.m_PsiStart_ij;
+        m_PsiJ_ik              = b.m_PsiJ_ik;
+        m_PsiStart_ik          = b.m_PsiStart_ik;
 
         m_gfunc_IJ            = b.m_gfunc_IJ;
         m_g2func_IJ           = b.m_g2func_IJ;
@@ -1399,6 +1410,111 @@ void HMWSoln::counterIJ_setup(void) const
     }
 }
 
+void HMWSoln::interactionLists_setup()
+{
+    /*
+     * Find the binary interactions between charged species which may be
+     * nonzero
+     */
+    m_CationAnionPairs.clear();
+    m_LikeChargePairs.clear();
+    m_ChargedPairs.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = i+1; j < m_kk; j++) {
+            size_t n = m_kk*i + j;
+            size_t counterIJ = m_CounterIJ[n];
+            bool active = false;
+            if (charge(i)*charge(j) < 0.0) {
+                active = (m_Beta0MX_ij[counterIJ] != 0.0 ||
+                          m_Beta1MX_ij[counterIJ] != 0.0 ||
+                          m_Beta2MX_ij[counterIJ] != 0.0 ||
+                          m_CphiMX_ij[counterIJ] != 0.0);
+                for (size_t c = 0; c < m_Beta0MX_ij_coeff.nRows() && !active; c++) {
+                    active = (m_Beta0MX_ij_coeff(c,counterIJ) != 0.0 ||
+                              m_Beta1MX_ij_coeff(c,counterIJ) != 0.0 ||
+                              m_Beta2MX_ij_coeff(c,counterIJ) != 0.0 ||
+                              m_CphiMX_ij_coeff(c,counterIJ) != 0.0);
+                }
+                if (active) {
+                    m_CationAnionPairs.push_back(n);
+                }
+            } else if (charge(i)*charge(j) > 0.0) {
+                active = (fabs(charge(i)) != fabs(charge(j)) ||
+                          m_Theta_ij[counterIJ] != 0.0);
+                for (size_t c = 0; c < m_Theta_ij_coeff.nRows() && !active; c++) {
+                    active = (m_Theta_ij_coeff(c,counterIJ) != 0.0);
+                }
+                if (active) {
+                    m_LikeChargePairs.push_back(n);
+                }
+            }
+            if (active) {
+                m_ChargedPairs.push_back(n);
+            }
+        }
+    }
+
+    m_CMXStart.assign(m_kk + 1, 0);
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        m_CMXStart[m_CationAnionPairs[p] / m_kk + 1]++;
+        m_CMXStart[m_CationAnionPairs[p] % m_kk + 1]++;
+    }
+    for (size_t i = 0; i < m_kk; i++) {
+        m_CMXStart[i+1] += m_CMXStart[i];
+    }
+    m_CMXPartners.resize(m_CMXStart[m_kk]);
+    std::vector<size_t> nextCMX(m_CMXStart.begin(), m_CMXStart.end() - 1);
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = 1; j < m_kk; j++) {
+            size_t n = (i < j) ? m_kk*i + j : m_kk*j + i;
+            if (std::binary_search(m_CationAnionPairs.begin(),
+                                   m_CationAnionPairs.end(), n)) {
+                m_CMXPartners[nextCMX[i]++] = j;
+            }
+        }
+    }
+
+    /*
+     * Find the ternary interactions which may be nonzero, and
+     * index them by the pairs (i,j) and (i,k).
+     */
+    m_PsiIndex.clear();
+    m_PsiK_ij.clear();
+    m_PsiStart_ij.assign(m_kk*m_kk + 1, 0);
+    m_PsiStart_ik.assign(m_kk*m_kk + 1, 0);
+    size_t nCoeffs = m_Psi_ijk_coeff.nRows();
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = 1; j < m_kk; j++) {
+            for (size_t k = 1; k < m_kk; k++) {
+                size_t n = k + j * m_kk + i * m_kk * m_kk;
+                bool active = (m_Psi_ijk[n] != 0.0);
+                for (size_t c = 0; c < nCoeffs && !active; c++) {
+                    active = (m_Psi_ijk_coeff(c,n) != 0.0);
+                }
+                if (active) {
+                    m_PsiIndex.push_back(n);
+                    m_PsiK_ij.push_back(k);
+                    m_PsiStart_ik[m_kk*i + k + 1]++;
+                }
+            }
+            m_PsiStart_ij[m_kk*i + j + 1] = m_PsiK_ij.size();
+        }
+    }
+    for (size_t n = 0; n < m_kk*m_kk; n++) {
+        m_PsiStart_ij[n+1] = std::max(m_PsiStart_ij[n+1], m_PsiStart_ij[n]);
+        m_PsiStart_ik[n+1] += m_PsiStart_ik[n];
+    }
+    m_PsiJ_ik.resize(m_PsiIndex.size());
+    std::vector<size_t> next(m_PsiStart_ik.begin(), m_PsiStart_ik.end() - 1);
+    for (size_t p = 0; p < m_PsiIndex.size(); p++) {
+        size_t n = m_PsiIndex[p];
+        size_t i = n / (m_kk * m_kk);
+        size_t j = (n / m_kk) % m_kk;
+        size_t k = n % m_kk;
+        m_PsiJ_ik[next[m_kk*i + k]++] = j;
+    }
+}
+
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
     double T = temperature();
@@ -1621,52 +1737,40 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 
     switch(m_formPitzerTemp) {
     case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
+      for (size_t p = 0; p < m_PsiIndex.size(); p++) {
+          size_t n = m_PsiIndex[p];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0];
       }
       break;
     case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n]    = Psi_coeff[1];
-                  m_Psi_ijk_LL[n]   = 0.0;
-              }
-          }
+      for (size_t p = 0; p < m_PsiIndex.size(); p++) {
+          size_t n = m_PsiIndex[p];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
+          m_Psi_ijk_L[n]    = Psi_coeff[1];
+          m_Psi_ijk_LL[n]   = 0.0;
       }
       break;
     case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
+      for (size_t p = 0; p < m_PsiIndex.size(); p++) {
+          size_t n = m_PsiIndex[p];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0]
+                         + Psi_coeff[1]*tlin
+                         + Psi_coeff[2]*tquad
+                         + Psi_coeff[3]*tinv
+                         + Psi_coeff[4]*tln;
+
+          m_Psi_ijk_L[n] = Psi_coeff[1]
+                           + Psi_coeff[2]*twoT
+                           - Psi_coeff[3]*invT2
+                           + Psi_coeff[4]*invT;
+
+          m_Psi_ijk_LL[n] =
+              Psi_coeff[2]*2.0
+              + Psi_coeff[3]*twoinvT3
+              - Psi_coeff[4]*invT2;
       }
       break;
     }
@@ -1804,53 +1908,45 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
 
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0 *
+                               (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -1863,47 +1959,37 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
 
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX[counterIJ]  = beta0MX[counterIJ]
-                                  + beta1MX[counterIJ] * gfunc[counterIJ]
-                                  + beta2MX[counterIJ] * g2func[counterIJ];
+        BMX[counterIJ]  = beta0MX[counterIJ]
+                          + beta1MX[counterIJ] * gfunc[counterIJ]
+                          + beta2MX[counterIJ] * g2func[counterIJ];
 
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX[counterIJ], beta0MX[counterIJ],
-                           beta1MX[counterIJ], beta2MX[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
-                                           beta2MX[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX[counterIJ] = 0.0;
-                }
-                BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
-            } else {
-                BMX[counterIJ]      = 0.0;
-                BprimeMX[counterIJ] = 0.0;
-                BphiMX[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ]);
-            }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX[counterIJ], beta0MX[counterIJ],
+                   beta1MX[counterIJ], beta2MX[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
+                                   beta2MX[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX[counterIJ] = 0.0;
+        }
+        BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ]);
         }
     }
 
@@ -1915,29 +2001,21 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX[counterIJ] = CphiMX[counterIJ]/
-                                 (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        CMX[counterIJ] = CphiMX[counterIJ]/
+                         (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX[counterIJ]);
         }
     }
 
@@ -1950,35 +2028,25 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                int z1 = (int) fabs(charge(i));
-                int z2 = (int) fabs(charge(j));
-                Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
-                Phiprime[counterIJ] = etheta_prime[z1][z2];
-                Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t n = m_LikeChargePairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        int z1 = (int) fabs(charge(i));
+        int z2 = (int) fabs(charge(j));
+        Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
+        Phiprime[counterIJ] = etheta_prime[z1][z2];
+        Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
         }
     }
 
@@ -1995,30 +2063,30 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of F = %10.6f \n", F);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                F = F + molality[i]*molality[j] * BprimeMX[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign
-             */
-            if (charge(i)*charge(j) > 0) {
-                F = F + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" F = %10.6f \n", F);
-            }
+    for (size_t p = 0; p < m_ChargedPairs.size(); p++) {
+        size_t n = m_ChargedPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * both species have a non-zero charge, and one is positive
+         * and the other is negative
+         */
+        if (charge(i)*charge(j) < 0) {
+            F = F + molality[i]*molality[j] * BprimeMX[counterIJ];
+        }
+        /*
+         * Both species have a non-zero charge, and they
+         * have the same sign
+         */
+        if (charge(i)*charge(j) > 0) {
+            F = F + molality[i]*molality[j] * Phiprime[counterIJ];
+        }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf(" F = %10.6f \n", F);
         }
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2071,9 +2139,10 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                          * non-duplicate sum over double anions, j, k, with
                          * respect to the cation, i.
                          */
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all anions
-                            if (charge(k) < 0.0) {
+                            if (k > j && charge(k) < 0.0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
                                 if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2101,7 +2170,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                             }
                         }
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             // two inner sums over anions
 
@@ -2114,19 +2184,22 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                            molality[j]*molality[k]*psi_ijk[n]);
                                 }
                             }
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
+                        }
+                    }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the j,k interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 + (fabs(charge(i))*
+                                       molality[j]*molality[k]*CMX[counterIJ2]);
+                        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+                            if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
+                                std::string snj = speciesName(j) + "," + speciesName(k) + ":";
+                                printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
+                                       fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
                             }
                         }
                     }
@@ -2147,7 +2220,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + i]; p < m_PsiStart_ij[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t izeta = j;
                             size_t jzeta = i;
@@ -2219,9 +2293,10 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                molality[j]* molarcharge*CMX[counterIJ]);
                     }
                     if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all cations
-                            if (charge(k) > 0) {
+                            if (k > j && charge(k) > 0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
                                 if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2251,7 +2326,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                             }
                         }
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) > 0.0) {
                             // two inner sums over cations
                             n = k + j * m_kk + i * m_kk * m_kk;
@@ -2263,20 +2339,23 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                            molality[j]*molality[k]*psi_ijk[n]);
                                 }
                             }
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
+                        }
+                    }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the symmetric binary interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 +
+                               (fabs(charge(i))*
+                                molality[j]*molality[k]*CMX[counterIJ2]);
+                        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+                            if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
+                                std::string snj = speciesName(j) + "," + speciesName(k) + ":";
+                                printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
+                                       fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
                             }
                         }
                     }
@@ -2297,7 +2376,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + i]; p < m_PsiStart_ik[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiJ_ik[p];
                         if (charge(k) > 0.0) {
                             size_t izeta = j;
                             size_t jzeta = k;
@@ -2349,7 +2429,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                  * Zeta term -> we piggyback on the psi term
                  */
                 if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t n = k + j * m_kk + i * m_kk * m_kk;
                             sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
@@ -2410,17 +2491,16 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
          * Loop Over Cations
          */
         if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
+            for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                size_t k = m_CMXPartners[p];
+                /*
+                 * Find the counterIJ for the symmetric j,k binary interaction
+                 */
+                size_t n = m_kk*j + k;
+                size_t counterIJ = m_CounterIJ[n];
 
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX[counterIJ] + molarcharge*CMX[counterIJ]);
-                }
+                sum1 = sum1 + molality[j]*molality[k]*
+                       (BphiMX[counterIJ] + molarcharge*CMX[counterIJ]);
             }
 
             for (size_t k = j+1; k < m_kk; k++) {
@@ -2437,7 +2517,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 = sum2 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) < 0.0) {
                             // species m is an anion
                             n = m + k * m_kk + j * m_kk * m_kk;
@@ -2468,7 +2549,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 = sum3 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) > 0.0) {
                             n = m + k * m_kk + j * m_kk * m_kk;
                             sum3 = sum3 +
@@ -2499,7 +2581,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                 }
                 if (charge(k) < 0.0) {
                     size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + k]; p < m_PsiStart_ik[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiJ_ik[p];
                         if (charge(m) > 0.0) {
                             size_t jzeta = m;
                             size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
@@ -2720,52 +2803,44 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0 *
+                               (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_L[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -2779,45 +2854,35 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_L[counterIJ]  = beta0MX_L[counterIJ]
-                                    + beta1MX_L[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_L[counterIJ] * gfunc[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
-                           beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_L[counterIJ] = 0.0;
-                }
-                BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
-            } else {
-                BMX_L[counterIJ]      = 0.0;
-                BprimeMX_L[counterIJ] = 0.0;
-                BphiMX_L[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        BMX_L[counterIJ]  = beta0MX_L[counterIJ]
+                            + beta1MX_L[counterIJ] * gfunc[counterIJ]
+                            + beta2MX_L[counterIJ] * gfunc[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
+                   beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_L[counterIJ] = 0.0;
+        }
+        BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
         }
     }
 
@@ -2829,29 +2894,21 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_L[counterIJ] = CphiMX_L[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_L[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        CMX_L[counterIJ] = CphiMX_L[counterIJ]/
+                           (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_L[counterIJ]);
         }
     }
 
@@ -2864,33 +2921,23 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_L[counterIJ] = thetaij_L[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_L[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t n = m_LikeChargePairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        Phi_L[counterIJ] = thetaij_L[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ]);
         }
     }
 
@@ -2907,30 +2954,30 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of dFdT = %10.6f \n", dFdT);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdT = %10.6f \n", dFdT);
-            }
+    for (size_t p = 0; p < m_ChargedPairs.size(); p++) {
+        size_t n = m_ChargedPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * both species have a non-zero charge, and one is positive
+         * and the other is negative
+         */
+        if (charge(i)*charge(j) < 0) {
+            dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
+        }
+        /*
+         * Both species have a non-zero charge, and they
+         * have the same sign, e.g., both positive or both negative.
+         */
+        if (charge(i)*charge(j) > 0) {
+            dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
+        }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf(" dFdT = %10.6f \n", dFdT);
         }
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2967,9 +3014,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                          * non-duplicate sum over double anions, j, k, with
                          * respect to the cation, i.
                          */
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all anions
-                            if (charge(k) < 0.0) {
+                            if (k > j && charge(k) < 0.0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
                             }
@@ -2983,21 +3031,25 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             // two inner sums over anions
 
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_L[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the j,k interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 + (fabs(charge(i))*
+                                       molality[j]*molality[k]*CMX_L[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -3009,7 +3061,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 /*
                  * Zeta interaction term
                  */
-                for (size_t k = 1; k < m_kk; k++) {
+                for (size_t p = m_PsiStart_ij[m_kk*j + i]; p < m_PsiStart_ij[m_kk*j + i + 1]; p++) {
+                    size_t k = m_PsiK_ij[p];
                     if (charge(k) < 0.0) {
                         size_t izeta = j;
                         size_t jzeta = i;
@@ -3063,9 +3116,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
                     if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all cations
-                            if (charge(k) > 0) {
+                            if (k > j && charge(k) > 0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
                             }
@@ -3081,21 +3135,25 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) > 0.0) {
                             // two inner sums over cations
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_L[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the symmetric binary interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 +
+                               (fabs(charge(i))*
+                                molality[j]*molality[k]*CMX_L[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -3103,7 +3161,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                  */
                 if (charge(j) == 0.0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + i]; p < m_PsiStart_ik[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiJ_ik[p];
                         if (charge(k) > 0.0) {
                             size_t izeta = j;
                             size_t jzeta = k;
@@ -3142,7 +3201,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                  * Zeta term -> we piggyback on the psi term
                  */
                 if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t n = k + j * m_kk + i * m_kk * m_kk;
                             sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
@@ -3190,17 +3250,16 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
          * Loop Over Cations
          */
         if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
+            for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                size_t k = m_CMXPartners[p];
+                /*
+                 * Find the counterIJ for the symmetric j,k binary interaction
+                 */
+                size_t n = m_kk*j + k;
+                size_t counterIJ = m_CounterIJ[n];
 
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                }
+                sum1 = sum1 + molality[j]*molality[k]*
+                       (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
             }
 
             for (size_t k = j+1; k < m_kk; k++) {
@@ -3217,7 +3276,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 = sum2 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) < 0.0) {
                             // species m is an anion
                             n = m + k * m_kk + j * m_kk * m_kk;
@@ -3248,7 +3308,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 = sum3 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) > 0.0) {
                             n = m + k * m_kk + j * m_kk * m_kk;
                             sum3 = sum3 +
@@ -3279,7 +3340,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 }
                 if (charge(k) < 0.0) {
                     size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + k]; p < m_PsiStart_ik[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiJ_ik[p];
                         if (charge(m) > 0.0) {
                             size_t jzeta = m;
                             size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
@@ -3490,52 +3552,44 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of gfunc(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
+            hfunc[counterIJ] = -2.0*
+                               (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_LL[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
     /*
      * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L ----------
@@ -3548,45 +3602,35 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
-                                     + beta1MX_LL[counterIJ] * gfunc[counterIJ]
-                                     + beta2MX_LL[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
-                           beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
-                                              beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_LL[counterIJ] = 0.0;
-                }
-                BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
-            } else {
-                BMX_LL[counterIJ]      = 0.0;
-                BprimeMX_LL[counterIJ] = 0.0;
-                BphiMX_LL[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
+                             + beta1MX_LL[counterIJ] * gfunc[counterIJ]
+                             + beta2MX_LL[counterIJ] * g2func[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
+                   beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
+                                      beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_LL[counterIJ] = 0.0;
+        }
+        BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
         }
     }
 
@@ -3598,29 +3642,21 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
-                                    (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_LL[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
+                            (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_LL[counterIJ]);
         }
     }
 
@@ -3633,33 +3669,23 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_LL[counterIJ] = thetaij_LL[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
-            } else {
-                Phi_LL[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t n = m_LikeChargePairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        Phi_LL[counterIJ] = thetaij_LL[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ]);
         }
     }
 
@@ -3675,30 +3701,30 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of d2FdT2 = %10.6f \n", d2FdT2);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" d2FdT2 = %10.6f \n", d2FdT2);
-            }
+    for (size_t p = 0; p < m_ChargedPairs.size(); p++) {
+        size_t n = m_ChargedPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * both species have a non-zero charge, and one is positive
+         * and the other is negative
+         */
+        if (charge(i)*charge(j) < 0) {
+            d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
+        }
+        /*
+         * Both species have a non-zero charge, and they
+         * have the same sign, e.g., both positive or both negative.
+         */
+        if (charge(i)*charge(j) > 0) {
+            d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
+        }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf(" d2FdT2 = %10.6f \n", d2FdT2);
         }
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -3736,9 +3762,10 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                          * non-duplicate sum over double anions, j, k, with
                          * respect to the cation, i.
                          */
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all anions
-                            if (charge(k) < 0.0) {
+                            if (k > j && charge(k) < 0.0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
                             }
@@ -3752,21 +3779,25 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             // two inner sums over anions
 
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_LL[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the j,k interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 + (fabs(charge(i))*
+                                       molality[j]*molality[k]*CMX_LL[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -3777,7 +3808,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + i]; p < m_PsiStart_ij[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t izeta = j;
                             size_t jzeta = i;
@@ -3832,9 +3864,10 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
                     if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all cations
-                            if (charge(k) > 0) {
+                            if (k > j && charge(k) > 0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
                             }
@@ -3850,21 +3883,25 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) > 0.0) {
                             // two inner sums over cations
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_LL[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the symmetric binary interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 +
+                               (fabs(charge(i))*
+                                molality[j]*molality[k]*CMX_LL[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -3875,7 +3912,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + i]; p < m_PsiStart_ik[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiJ_ik[p];
                         if (charge(k) > 0.0) {
                             size_t izeta = j;
                             size_t jzeta = k;
@@ -3913,7 +3951,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                  * Zeta term -> we piggyback on the psi term
                  */
                 if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t n = k + j * m_kk + i * m_kk * m_kk;
                             sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
@@ -3960,17 +3999,16 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
          * Loop Over Cations
          */
         if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
+            for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                size_t k = m_CMXPartners[p];
+                /*
+                 * Find the counterIJ for the symmetric j,k binary interaction
+                 */
+                size_t n = m_kk*j + k;
+                size_t counterIJ = m_CounterIJ[n];
 
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                }
+                sum1 = sum1 + molality[j]*molality[k]*
+                       (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
             }
 
             for (size_t k = j+1; k < m_kk; k++) {
@@ -3987,7 +4025,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 = sum2 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) < 0.0) {
                             // species m is an anion
                             n = m + k * m_kk + j * m_kk * m_kk;
@@ -4018,7 +4057,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 = sum3 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) > 0.0) {
                             n = m + k * m_kk + j * m_kk * m_kk;
                             sum3 = sum3 +
@@ -4049,7 +4089,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                 }
                 if (charge(k) < 0.0) {
                     size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + k]; p < m_PsiStart_ik[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiJ_ik[p];
                         if (charge(m) > 0.0) {
                             size_t jzeta = m;
                             size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
@@ -4255,52 +4296,44 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0*
+                               (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_P[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -4314,45 +4347,35 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_P[counterIJ]  = beta0MX_P[counterIJ]
-                                    + beta1MX_P[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_P[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
-                           beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_P[counterIJ] = 0.0;
-                }
-                BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
-            } else {
-                BMX_P[counterIJ]      = 0.0;
-                BprimeMX_P[counterIJ] = 0.0;
-                BphiMX_P[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        BMX_P[counterIJ]  = beta0MX_P[counterIJ]
+                            + beta1MX_P[counterIJ] * gfunc[counterIJ]
+                            + beta2MX_P[counterIJ] * g2func[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
+                   beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_P[counterIJ] = 0.0;
+        }
+        BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
         }
     }
 
@@ -4363,29 +4386,21 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_P[counterIJ] = CphiMX_P[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_P[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t n = m_CationAnionPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        CMX_P[counterIJ] = CphiMX_P[counterIJ]/
+                           (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_P[counterIJ]);
         }
     }
 
@@ -4398,33 +4413,23 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_P[counterIJ] = thetaij_P[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_P[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t n = m_LikeChargePairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        Phi_P[counterIJ] = thetaij_P[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ]);
         }
     }
 
@@ -4441,30 +4446,30 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of dFdP = %10.6f \n", dFdP);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdP = %10.6f \n", dFdP);
-            }
+    for (size_t p = 0; p < m_ChargedPairs.size(); p++) {
+        size_t n = m_ChargedPairs[p];
+        size_t i = n / m_kk;
+        size_t j = n % m_kk;
+        /*
+         * Find the counterIJ for the symmetric binary interaction
+         */
+        size_t counterIJ = m_CounterIJ[n];
+        /*
+         * both species have a non-zero charge, and one is positive
+         * and the other is negative
+         */
+        if (charge(i)*charge(j) < 0) {
+            dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
+        }
+        /*
+         * Both species have a non-zero charge, and they
+         * have the same sign, e.g., both positive or both negative.
+         */
+        if (charge(i)*charge(j) > 0) {
+            dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
+        }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf(" dFdP = %10.6f \n", dFdP);
         }
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -4501,9 +4506,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                          * non-duplicate sum over double anions, j, k, with
                          * respect to the cation, i.
                          */
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all anions
-                            if (charge(k) < 0.0) {
+                            if (k > j && charge(k) < 0.0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
                             }
@@ -4517,21 +4523,25 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             // two inner sums over anions
 
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_P[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the j,k interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 + (fabs(charge(i))*
+                                       molality[j]*molality[k]*CMX_P[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -4542,7 +4552,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + i]; p < m_PsiStart_ij[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t izeta = j;
                             size_t jzeta = i;
@@ -4598,9 +4609,10 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
                     if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
+                        for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                            size_t k = m_PsiK_ij[p];
                             // an inner sum over all cations
-                            if (charge(k) > 0) {
+                            if (k > j && charge(k) > 0) {
                                 n = k + j * m_kk + i * m_kk * m_kk;
                                 sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
                             }
@@ -4616,21 +4628,25 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) > 0.0) {
                             // two inner sums over cations
                             n = k + j * m_kk + i * m_kk * m_kk;
                             sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_P[counterIJ2]);
                         }
                     }
+                    for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                        size_t k = m_CMXPartners[p];
+                        /*
+                         * Find the counterIJ for the symmetric binary interaction
+                         */
+                        n = m_kk*j + k;
+                        size_t counterIJ2 = m_CounterIJ[n];
+                        sum4 = sum4 +
+                               (fabs(charge(i))*
+                                molality[j]*molality[k]*CMX_P[counterIJ2]);
+                    }
                 }
 
                 /*
@@ -4641,7 +4657,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     /*
                      * Zeta interaction term
                      */
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + i]; p < m_PsiStart_ik[m_kk*j + i + 1]; p++) {
+                        size_t k = m_PsiJ_ik[p];
                         if (charge(k) > 0.0) {
                             size_t izeta = j;
                             size_t jzeta = k;
@@ -4678,7 +4695,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                  * Zeta term -> we piggyback on the psi term
                  */
                 if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*i + j]; p < m_PsiStart_ij[m_kk*i + j + 1]; p++) {
+                        size_t k = m_PsiK_ij[p];
                         if (charge(k) < 0.0) {
                             size_t n = k + j * m_kk + i * m_kk * m_kk;
                             sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
@@ -4725,17 +4743,16 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
          * Loop Over Cations
          */
         if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
+            for (size_t p = m_CMXStart[j]; p < m_CMXStart[j+1]; p++) {
+                size_t k = m_CMXPartners[p];
+                /*
+                 * Find the counterIJ for the symmetric j,k binary interaction
+                 */
+                size_t n = m_kk*j + k;
+                size_t counterIJ = m_CounterIJ[n];
 
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                }
+                sum1 = sum1 + molality[j]*molality[k]*
+                       (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
             }
 
             for (size_t k = j+1; k < m_kk; k++) {
@@ -4752,7 +4769,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     size_t n = m_kk*j + k;
                     size_t counterIJ = m_CounterIJ[n];
                     sum2 = sum2 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) < 0.0) {
                             // species m is an anion
                             n = m + k * m_kk + j * m_kk * m_kk;
@@ -4784,7 +4802,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     size_t counterIJ = m_CounterIJ[n];
 
                     sum3 = sum3 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ij[m_kk*j + k]; p < m_PsiStart_ij[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiK_ij[p];
                         if (charge(m) > 0.0) {
                             n = m + k * m_kk + j * m_kk * m_kk;
                             sum3 = sum3 +
@@ -4815,7 +4834,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                 }
                 if (charge(k) < 0.0) {
                     size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
+                    for (size_t p = m_PsiStart_ik[m_kk*j + k]; p < m_PsiStart_ik[m_kk*j + k + 1]; p++) {
+                        size_t m = m_PsiJ_ik[p];
                         if (charge(m) > 0.0) {
                             size_t jzeta = m;
                             size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
@@ -1567,6 +1567,8 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
         }
     }
 
+    interactionLists_setup();
+
     IMS_typeCutoff_ = 2;
     if (IMS_typeCutoff_ == 2) {
         calcIMSCutoffParams_();
@@ -71,6 +71,7 @@ Phase& Phase::operator=(const Phase& right)
     m_stateNum = -1;
 
     m_speciesNames = right.m_speciesNames;
+    m_speciesIndices = right.m_speciesIndices;
     m_speciesComp = right.m_speciesComp;
     m_speciesCharge = right.m_speciesCharge;
     m_speciesSize = right.m_speciesSize;
@@ -256,15 +257,18 @@ void Phase::getAtoms(size_t k, double* atomArray) const
 
 size_t Phase::speciesIndex(const std::string& nameStr) const
 {
+    map<string, size_t>::const_iterator it;
+    if (nameStr.find_first_of(" ;\n\t\r\v\f:") == string::npos) {
+        // Plain species name, which parseSpeciesName would leave unchanged
+        it = m_speciesIndices.find(nameStr);
+        return (it != m_speciesIndices.end()) ? it->second : npos;
+    }
     std::string pn;
     std::string sn = parseSpeciesName(nameStr, pn);
     if (pn == "" || pn == m_name || pn == m_id) {
-        vector<string>::const_iterator it = m_speciesNames.begin();
-        for (size_t k = 0; k < m_kk; k++) {
-            if (*it == sn) {
-                return k;
-            }
-            ++it;
+        it = m_speciesIndices.find(sn);
+        if (it != m_speciesIndices.end()) {
+            return it->second;
         }
         return npos;
     }
@@ -868,6 +872,8 @@ bool Phase::addSpecies(const Species& spec) {
     }
 
     m_speciesNames.push_back(spec.name);
+    // If species names are repeated, the index of the first one is kept
+    m_speciesIndices.insert(std::make_pair(spec.name, m_kk));
     m_speciesCharge.push_back(spec.charge);
     m_speciesSize.push_back(spec.size);
     size_t ne = nElements();
@@ -939,28 +945,28 @@ void Phase::addSpecies(const std::string& name_, const doublereal* comp,
 void Phase::addUniqueSpecies(const std::string& name_, const doublereal* comp,
                              doublereal charge_, doublereal size_)
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        if (m_speciesNames[k] == name_) {
-            // We have found a match. Do some compatibility checks.
-            for (size_t i = 0; i < m_mm; i++) {
-                if (comp[i] != m_speciesComp[k * m_mm + i]) {
-                    throw CanteraError("addUniqueSpecies",
-                                       "Duplicate species have different "
-                                       "compositions: " + name_);
-                }
-            }
-            if (charge_ != m_speciesCharge[k]) {
+    map<string, size_t>::const_iterator iter = m_speciesIndices.find(name_);
+    if (iter != m_speciesIndices.end()) {
+        // We have found a match. Do some compatibility checks.
+        size_t k = iter->second;
+        for (size_t i = 0; i < m_mm; i++) {
+            if (comp[i] != m_speciesComp[k * m_mm + i]) {
                 throw CanteraError("addUniqueSpecies",
                                    "Duplicate species have different "
-                                   "charges: " + name_);
+                                   "compositions: " + name_);
             }
-            if (size_ != m_speciesSize[k]) {
-                throw CanteraError("addUniqueSpecies",
-                                   "Duplicate species have different "
-                                   "sizes: " + name_);
-            }
-            return;
         }
+        if (charge_ != m_speciesCharge[k]) {
+            throw CanteraError("addUniqueSpecies",
+                               "Duplicate species have different "
+                               "charges: " + name_);
+        }
+        if (size_ != m_speciesSize[k]) {
+            throw CanteraError("addUniqueSpecies",
+                               "Duplicate species have different "
+                               "sizes: " + name_);
+        }
+        return;
     }
     addSpecies(name_, comp, charge_, size_);
 }
@@ -171,6 +171,21 @@ tpx::Substance& PureFluidPhase::TPX_Substance()
     return *m_sub;
 }
 
+void PureFluidPhase::setStates(tpx::PropertyPair::type XY, size_t n,
+                               const doublereal* x, const doublereal* y,
+                               doublereal* T, doublereal* rho)
+{
+    if (n == 0) {
+        return;
+    }
+    setTPXState();
+    m_sub->setStates(XY, n, x, y, T, rho);
+    for (size_t i = 0; i < n; i++) {
+        rho[i] = 1.0/rho[i];
+    }
+    setState_TR(T[n-1], rho[n-1]);
+}
+
 void  PureFluidPhase::getPartialMolarEnthalpies(doublereal* hbar) const
 {
     hbar[0] = enthalpy_mole();
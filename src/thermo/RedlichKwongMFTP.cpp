@@ -34,7 +34,19 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadT_current(0.0),
+    m_tempAB(-1.0),
+    m_stateNumAB(-2),
+    m_critValid(false),
+    m_tc_current(0.0),
+    m_pc_current(0.0),
+    m_vc_current(0.0),
     NSolns_(0),
+    m_rootsTemp(-1.0),
+    m_rootsPres(-1.0),
+    m_rootsA(0.0),
+    m_rootsB(0.0),
     dpdV_(0.0),
     dpdT_(0.0)
 {
@@ -48,7 +60,19 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, std::string id_) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadT_current(0.0),
+    m_tempAB(-1.0),
+    m_stateNumAB(-2),
+    m_critValid(false),
+    m_tc_current(0.0),
+    m_pc_current(0.0),
+    m_vc_current(0.0),
     NSolns_(0),
+    m_rootsTemp(-1.0),
+    m_rootsPres(-1.0),
+    m_rootsA(0.0),
+    m_rootsB(0.0),
     dpdV_(0.0),
     dpdT_(0.0)
 {
@@ -72,7 +96,19 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadT_current(0.0),
+    m_tempAB(-1.0),
+    m_stateNumAB(-2),
+    m_critValid(false),
+    m_tc_current(0.0),
+    m_pc_current(0.0),
+    m_vc_current(0.0),
     NSolns_(0),
+    m_rootsTemp(-1.0),
+    m_rootsPres(-1.0),
+    m_rootsA(0.0),
+    m_rootsB(0.0),
     dpdV_(0.0),
     dpdT_(0.0)
 {
@@ -91,7 +127,19 @@ RedlichKwongMFTP::RedlichKwongMFTP(int testProb) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadT_current(0.0),
+    m_tempAB(-1.0),
+    m_stateNumAB(-2),
+    m_critValid(false),
+    m_tc_current(0.0),
+    m_pc_current(0.0),
+    m_vc_current(0.0),
     NSolns_(0),
+    m_rootsTemp(-1.0),
+    m_rootsPres(-1.0),
+    m_rootsA(0.0),
+    m_rootsB(0.0),
     dpdV_(0.0),
     dpdT_(0.0)
 {
@@ -119,7 +167,19 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_a0_current(0.0),
+    m_dadT_current(0.0),
+    m_tempAB(-1.0),
+    m_stateNumAB(-2),
+    m_critValid(false),
+    m_tc_current(0.0),
+    m_pc_current(0.0),
+    m_vc_current(0.0),
     NSolns_(0),
+    m_rootsTemp(-1.0),
+    m_rootsPres(-1.0),
+    m_rootsA(0.0),
+    m_rootsB(0.0),
     dpdV_(0.0),
     dpdT_(0.0)
 {
@@ -154,10 +214,15 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         Vroot_[2] = b.Vroot_[2];
         m_pp       = b.m_pp;
         m_tmpV     = b.m_tmpV;
+        m_aSum     = b.m_aSum;
+        m_aSum_T   = b.m_aSum_T;
+        m_a0_current = b.m_a0_current;
+        m_dadT_current = b.m_dadT_current;
         m_partialMolarVolumes = b.m_partialMolarVolumes;
         dpdV_ = b.dpdV_;
         dpdT_ = b.dpdT_;
         dpdni_ = b.dpdni_;
+        resetMixingCache();
     }
     return *this;
 }
@@ -336,20 +401,13 @@ void RedlichKwongMFTP::getActivityCoefficients(doublereal* ac) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
 
     for (size_t k = 0; k < m_kk; k++) {
         ac[k] = (- rt * log(pres * mv / rt)
                  + rt * log(mv / vmb)
                  + rt * b_vec_Curr_[k] / vmb
-                 - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                 - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                  + m_a_current *  b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                  - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                 );
@@ -387,13 +445,6 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
     doublereal vpb = mv + m_b_current;
     doublereal vmb = mv - m_b_current;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
     doublereal pres = pressure();
     doublereal refP = refPressure();
 
@@ -401,7 +452,7 @@ void RedlichKwongMFTP::getChemPotentials(doublereal* mu) const
         mu[k] += (rt * log(pres/refP) - rt * log(pres * mv / rt)
                   + rt * log(mv / vmb)
                   + rt * b_vec_Curr_[k] / vmb
-                  - 2.0 * m_pp[k] / (m_b_current * sqt) * log(vpb/mv)
+                  - 2.0 * m_aSum[k] / (m_b_current * sqt) * log(vpb/mv)
                   + m_a_current *  b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv)
                   - m_a_current / (m_b_current * sqt) * (b_vec_Curr_[k]/vpb)
                  );
@@ -428,36 +479,19 @@ void RedlichKwongMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
     doublereal vmb = mv - m_b_current;
 
     for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-
-
-    for (size_t k = 0; k < m_kk; k++) {
-        dpdni_[k] = rt/vmb + rt * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_pp[k] / (sqt * mv * vpb)
+        dpdni_[k] = rt/vmb + rt * b_vec_Curr_[k] / (vmb * vmb) - 2.0 * m_aSum[k] / (sqt * mv * vpb)
                     + m_a_current * b_vec_Curr_[k]/(sqt * mv * vpb * vpb);
     }
     doublereal dadt = da_dt();
     doublereal fac = TKelvin * dadt - 3.0 * m_a_current / 2.0;
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += 2.0 * moleFractions_[i] * TKelvin * a_coeff_vec(1,counter) - 3.0 *  moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
 
     pressureDerivatives();
     doublereal fac2 = mv + TKelvin * dpdT_ / dpdV_;
 
     for (size_t k = 0; k < m_kk; k++) {
         double hE_v = (mv * dpdni_[k] - rt -  b_vec_Curr_[k]/ (m_b_current * m_b_current * sqt) * log(vpb/mv)*fac
-                       + 1.0 / (m_b_current * sqt) * log(vpb/mv) * m_tmpV[k]
+                       + 1.0 / (m_b_current * sqt) * log(vpb/mv) * (2.0 * TKelvin * m_aSum_T[k] - 3.0 * m_aSum[k])
                        +  b_vec_Curr_[k] / vpb / (m_b_current * sqt) * fac);
         hbar[k] = hbar[k] + hE_v;
 
@@ -482,23 +516,6 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
         sbar[k] += r * (- log(xx));
     }
 
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
-
     doublereal dadt = da_dt();
     doublereal fac = dadt -  m_a_current / (2.0 * TKelvin);
     doublereal vmb = mv - m_b_current;
@@ -510,8 +527,8 @@ void RedlichKwongMFTP::getPartialMolarEntropies(doublereal* sbar) const
                    + GasConstant
                    + GasConstant * log(mv/vmb)
                    + GasConstant * b_vec_Curr_[k]/vmb
-                   + m_pp[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
-                   - 2.0 * m_tmpV[k]/(m_b_current * sqt) * log(vpb/mv)
+                   + m_aSum[k]/(m_b_current * TKelvin * sqt) * log(vpb/mv)
+                   - 2.0 * m_aSum_T[k]/(m_b_current * sqt) * log(vpb/mv)
                    + b_vec_Curr_[k] / (m_b_current * m_b_current * sqt) * log(vpb/mv) * fac
                    - 1.0 / (m_b_current * sqt) *  b_vec_Curr_[k] / vpb * fac
                   ) ;
@@ -540,22 +557,6 @@ void RedlichKwongMFTP::getPartialMolarCp(doublereal* cpbar) const
 
 void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        m_pp[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_pp[k] += moleFractions_[i] * a_vec_Curr_[counter];
-        }
-    }
-
-    for (size_t k = 0; k < m_kk; k++) {
-        m_tmpV[k] = 0.0;
-        for (size_t i = 0; i < m_kk; i++) {
-            size_t counter = k + m_kk*i;
-            m_tmpV[k] += moleFractions_[i] * a_coeff_vec(1,counter);
-        }
-    }
-
     doublereal TKelvin = temperature();
     doublereal sqt = sqrt(TKelvin);
     doublereal mv = molarVolume();
@@ -569,7 +570,7 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
         doublereal num = (rt + rt * m_b_current/ vmb + rt * b_vec_Curr_[k] / vmb
                           + rt *  m_b_current * b_vec_Curr_[k] /(vmb * vmb)
-                          - 2.0 * m_pp[k] / (sqt * vpb)
+                          - 2.0 * m_aSum[k] / (sqt * vpb)
                           + m_a_current *  b_vec_Curr_[k] / (sqt * vpb * vpb)
                          );
 
@@ -583,85 +584,33 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
 doublereal RedlichKwongMFTP::critTemperature() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return tc;
+    updateCriticalConditions();
+    return m_tc_current;
 }
 
 doublereal RedlichKwongMFTP::critPressure() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-
-    return pc;
+    updateCriticalConditions();
+    return m_pc_current;
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return vc;
+    updateCriticalConditions();
+    return m_vc_current;
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return pc*vc/tc/GasConstant;
+    updateCriticalConditions();
+    return m_pc_current*m_vc_current/m_tc_current/GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-
+    updateCriticalConditions();
     double mmw = meanMolecularWeight();
-    return mmw / vc;
+    return mmw / m_vc_current;
 }
 
 void RedlichKwongMFTP::initThermo()
@@ -718,6 +667,8 @@ void RedlichKwongMFTP::initLengths()
 
     m_pp.resize(m_kk, 0.0);
     m_tmpV.resize(m_kk, 0.0);
+    m_aSum.resize(m_kk, 0.0);
+    m_aSum_T.resize(m_kk, 0.0);
     m_partialMolarVolumes.resize(m_kk, 0.0);
     dpdni_.resize(m_kk, 0.0);
 }
@@ -802,6 +753,7 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         double bi = b_vec_Curr_[i];
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
+    resetMixingCache();
 
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
@@ -1017,6 +969,7 @@ doublereal RedlichKwongMFTP::liquidVolEst(doublereal TKelvin, doublereal& presGu
         } else {
             foundLiq = true;
         }
+        m++;
     } while ((m < 100) && (!foundLiq));
 
     if (foundLiq) {
@@ -1060,7 +1013,14 @@ doublereal RedlichKwongMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
     }
 
     doublereal volguess = mmw / rhoguess;
-    NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+    if (TKelvin != m_rootsTemp || presPa != m_rootsPres ||
+            m_a_current != m_rootsA || m_b_current != m_rootsB) {
+        NSolns_ = NicholsSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+        m_rootsTemp = TKelvin;
+        m_rootsPres = presPa;
+        m_rootsA = m_a_current;
+        m_rootsB = m_b_current;
+    }
 
     doublereal molarVolLast = Vroot_[0];
     if (NSolns_ >= 2) {
@@ -1188,62 +1148,102 @@ void RedlichKwongMFTP::updateMixingExpressions()
 void RedlichKwongMFTP::updateAB()
 {
     double temp = temperature();
-    if (m_formTempParam == 1) {
+    bool newComposition = (stateMFNumber() != m_stateNumAB);
+    bool newTemperature = (temp != m_tempAB);
+    if (!newComposition && (!newTemperature || m_formTempParam == 0)) {
+        return;
+    }
+    if (newTemperature) {
+        for (size_t n = 0; n < m_kk * m_kk; n++) {
+            a_vec_Curr_[n] = a_coeff_vec(0,n) + a_coeff_vec(1,n) * temp;
+        }
+    }
+
+    /*
+     * The mixture parameters are accumulated one species row at a time, so
+     * that the inner loops run over contiguous storage. Species which are
+     * not present are skipped.
+     */
+    const doublereal* x = DATA_PTR(moleFractions_);
+    if (newComposition) {
+        m_b_current = 0.0;
         for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+            m_b_current += x[i] * b_vec_Curr_[i];
+        }
+        if (m_formTempParam == 1) {
+            std::fill(m_aSum_T.begin(), m_aSum_T.end(), 0.0);
+            std::fill(m_tmpV.begin(), m_tmpV.end(), 0.0);
+            for (size_t i = 0; i < m_kk; i++) {
+                if (x[i] == 0.0) {
+                    continue;
+                }
+                for (size_t k = 0; k < m_kk; k++) {
+                    m_tmpV[k] += x[i] * a_coeff_vec(0, k + m_kk * i);
+                    m_aSum_T[k] += x[i] * a_coeff_vec(1, k + m_kk * i);
+                }
             }
+            m_a0_current = dot(x, x + m_kk, m_tmpV.begin());
+            m_dadT_current = dot(x, x + m_kk, m_aSum_T.begin());
         }
+        m_critValid = false;
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
+    std::fill(m_aSum.begin(), m_aSum.end(), 0.0);
     for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
-        for (size_t j = 0; j < m_kk; j++) {
-            m_a_current +=  a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+        const doublereal xi = x[i];
+        if (xi == 0.0) {
+            continue;
+        }
+        const doublereal* a_i = &a_vec_Curr_[m_kk * i];
+        for (size_t k = 0; k < m_kk; k++) {
+            m_aSum[k] += xi * a_i[k];
         }
     }
+    m_a_current = dot(x, x + m_kk, m_aSum.begin());
+    if (m_formTempParam == 0) {
+        m_a0_current = m_a_current;
+    }
+
+    m_tempAB = temp;
+    m_stateNumAB = stateMFNumber();
+}
+
+void RedlichKwongMFTP::resetMixingCache()
+{
+    m_tempAB = -1.0;
+    m_stateNumAB = -2;
+    m_critValid = false;
+    m_rootsTemp = -1.0;
 }
 
 void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
+    // The a_ij are linear functions of the temperature, so the mixture
+    // value can be computed from the coefficients for the current composition
+    bCalc = m_b_current;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc = m_a0_current + m_dadT_current * temp;
     } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        aCalc = m_a_current;
     }
 }
 
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
     if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+=  a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+        return m_dadT_current;
+    }
+    return 0.0;
+}
+
+void RedlichKwongMFTP::updateCriticalConditions() const
+{
+    if (!m_critValid) {
+        calcCriticalConditions(m_a_current, m_b_current, m_a0_current,
+                               m_dadT_current, m_pc_current, m_tc_current,
+                               m_vc_current);
+        m_critValid = true;
     }
-    return dadT;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -41,7 +41,8 @@ WaterPropsIAPWS::WaterPropsIAPWS() :
     m_phi(0),
     tau(-1.0),
     delta(-1.0),
-    iState(-30000)
+    iState(-30000),
+    m_table(0)
 {
     m_phi = new WaterPropsIAPWSphi();
 }
@@ -50,7 +51,8 @@ WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     m_phi(0),
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_table(b.m_table)
 {
     m_phi = new WaterPropsIAPWSphi();
     m_phi->tdpolycalc(tau, delta);
@@ -64,6 +66,7 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     tau = b.tau;
     delta = b.delta;
     iState = b.iState;
+    m_table = b.m_table;
     m_phi->tdpolycalc(tau, delta);
     return *this;
 }
@@ -111,6 +114,32 @@ doublereal  WaterPropsIAPWS::pressure() const
 doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
+    if (m_table) {
+        /*
+         * Refine the tabulated density for the branch that would be found
+         * starting from the supplied guesses.
+         */
+        int branch = WATER_GAS;
+        if (rhoguess != -1.0) {
+            branch = (rhoguess > Rho_c) ? WATER_LIQUID : WATER_GAS;
+        } else if (phase == WATER_LIQUID) {
+            branch = WATER_LIQUID;
+        } else if (phase == WATER_UNSTABLELIQUID || phase == WATER_UNSTABLEGAS) {
+            branch = -1;
+        }
+        doublereal rhoTable = m_table->density(temperature, pressure, branch);
+        if (rhoTable > 0.0) {
+            doublereal p_red = pressure * M_water / (Rgas * temperature * Rho_c);
+            tau = T_c / temperature;
+            doublereal delta_retn = m_phi->dfindNewton(p_red, tau, rhoTable / Rho_c);
+            if (delta_retn > 0.0) {
+                doublereal density_retn = delta_retn * Rho_c;
+                setState_TR(temperature, density_retn);
+                return density_retn;
+            }
+        }
+    }
+
     doublereal deltaGuess = 0.0;
     if (rhoguess == -1.0) {
         if (phase != -1) {
@@ -371,7 +400,15 @@ doublereal WaterPropsIAPWS::psat(doublereal temperature, int waterState)
         setState_TR(temperature, densGas);
         return P_c;
     }
-    doublereal p = psat_est(temperature);
+    doublereal p = -1.0;
+    if (m_table) {
+        p = m_table->psat(temperature, densLiq, densGas);
+    }
+    if (p <= 0.0) {
+        densLiq = -1.0;
+        densGas = -1.0;
+        p = psat_est(temperature);
+    }
     for (int i = 0; i < 30; i++) {
         if (method == 1) {
             corr(temperature, p, densLiq, densGas, delGRT);
@@ -0,0 +1,295 @@
+/**
+ * @file WaterPropsIAPWSTable.cpp
+ * Definitions for the tabulated density and saturation properties of water
+ * (see class \link Cantera::WaterPropsIAPWSTable WaterPropsIAPWSTable\endlink).
+ */
+#include "cantera/thermo/WaterPropsIAPWSTable.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Density at the critical point (kg m-3), which separates the liquid and
+//! vapor branches below the critical temperature
+const doublereal Rho_c = 322.;
+
+//! Cubic Hermite basis functions. h[0] and h[1] multiply the values at
+//! t = 0 and t = 1, and h[2] and h[3] multiply the derivatives.
+void hermiteBasis(doublereal t, doublereal* h)
+{
+    doublereal t2 = t * t;
+    doublereal t3 = t2 * t;
+    h[0] = 2.0 * t3 - 3.0 * t2 + 1.0;
+    h[1] = -2.0 * t3 + 3.0 * t2;
+    h[2] = t3 - 2.0 * t2 + t;
+    h[3] = t3 - t2;
+}
+
+}
+
+WaterPropsIAPWSTable::WaterPropsIAPWSTable(doublereal Tmin, doublereal Tmax,
+        size_t nT, doublereal Pmin, doublereal Pmax, size_t nP,
+        doublereal rtol) :
+    m_Tmin(Tmin),
+    m_Tmax(Tmax),
+    m_nT(nT),
+    m_lnPmin(log(Pmin)),
+    m_lnPmax(log(Pmax)),
+    m_nP(nP),
+    m_rtol(rtol),
+    m_maxError(0.0)
+{
+    if (nT < 2 || nP < 2 || Tmin >= Tmax || Pmin >= Pmax || Pmin <= 0.0) {
+        throw CanteraError("WaterPropsIAPWSTable::WaterPropsIAPWSTable",
+                           "Invalid table dimensions");
+    }
+    if (Tmax >= 647.096) {
+        throw CanteraError("WaterPropsIAPWSTable::WaterPropsIAPWSTable",
+                           "Maximum temperature must be below the critical "
+                           "temperature");
+    }
+    m_dT = (m_Tmax - m_Tmin) / (m_nT - 1);
+    m_dlnP = (m_lnPmax - m_lnPmin) / (m_nP - 1);
+    for (size_t phase = 0; phase < 2; phase++) {
+        buildPhase(phase);
+        checkPhase(phase);
+    }
+    buildSaturation();
+}
+
+void WaterPropsIAPWSTable::buildPhase(size_t phase)
+{
+    WaterPropsIAPWS water;
+    int waterState = (phase == 0) ? WATER_LIQUID : WATER_GAS;
+    size_t n = m_nT * m_nP;
+    m_lnRho[phase].assign(n, 0.0);
+    m_dT_lnRho[phase].assign(n, 0.0);
+    m_dP_lnRho[phase].assign(n, 0.0);
+    m_dTP_lnRho[phase].assign(n, 0.0);
+    m_nodeOK[phase].assign(n, 0);
+    for (size_t i = 0; i < m_nT; i++) {
+        doublereal T = m_Tmin + i * m_dT;
+        for (size_t j = 0; j < m_nP; j++) {
+            doublereal P = exp(m_lnPmin + j * m_dlnP);
+            doublereal rho = water.density(T, P, waterState);
+            if (rho <= 0.0 || (phase == 0) != (rho > Rho_c)) {
+                continue;
+            }
+            size_t k = i * m_nP + j;
+            m_nodeOK[phase][k] = 1;
+            m_lnRho[phase][k] = log(rho);
+            m_dT_lnRho[phase][k] = - water.coeffThermExp();
+            m_dP_lnRho[phase][k] = P * water.isothermalCompressibility();
+        }
+    }
+
+    // Cross derivatives, from differences of the pressure derivatives
+    for (size_t i = 0; i < m_nT; i++) {
+        for (size_t j = 0; j < m_nP; j++) {
+            size_t k = i * m_nP + j;
+            if (!m_nodeOK[phase][k]) {
+                continue;
+            }
+            bool lo = (i > 0 && m_nodeOK[phase][k - m_nP]);
+            bool hi = (i + 1 < m_nT && m_nodeOK[phase][k + m_nP]);
+            const vector_fp& fP = m_dP_lnRho[phase];
+            if (lo && hi) {
+                m_dTP_lnRho[phase][k] = (fP[k + m_nP] - fP[k - m_nP]) / (2 * m_dT);
+            } else if (hi) {
+                m_dTP_lnRho[phase][k] = (fP[k + m_nP] - fP[k]) / m_dT;
+            } else if (lo) {
+                m_dTP_lnRho[phase][k] = (fP[k] - fP[k - m_nP]) / m_dT;
+            }
+        }
+    }
+}
+
+void WaterPropsIAPWSTable::checkPhase(size_t phase)
+{
+    WaterPropsIAPWS water;
+    int waterState = (phase == 0) ? WATER_LIQUID : WATER_GAS;
+    const std::vector<int>& ok = m_nodeOK[phase];
+    std::vector<int>& cellOK = m_cellOK[phase];
+    cellOK.assign(m_nT * m_nP, 0);
+    for (size_t i = 0; i + 1 < m_nT; i++) {
+        for (size_t j = 0; j + 1 < m_nP; j++) {
+            size_t k = i * m_nP + j;
+            cellOK[k] = ok[k] && ok[k+1] && ok[k+m_nP] && ok[k+m_nP+1];
+        }
+    }
+
+    // Offsets (in units of half of a cell) of the points checked in each
+    // cell. The points on the upper edges are interpolated using the
+    // neighboring cells, which give the same values there.
+    static const int check[5][2] = {{1, 1}, {1, 0}, {0, 1}, {2, 1}, {1, 2}};
+    for (size_t i = 0; i + 1 < m_nT; i++) {
+        for (size_t j = 0; j + 1 < m_nP; j++) {
+            size_t k = i * m_nP + j;
+            if (!cellOK[k]) {
+                continue;
+            }
+            doublereal cellError = 0.0;
+            for (size_t m = 0; m < 5; m++) {
+                doublereal T = m_Tmin + (i + 0.5 * check[m][0]) * m_dT;
+                doublereal lnP = m_lnPmin + (j + 0.5 * check[m][1]) * m_dlnP;
+                doublereal rho = water.density(T, exp(lnP), waterState);
+                doublereal lnRho;
+                if (!interpolate(phase, T, lnP, lnRho) || rho <= 0.0
+                        || (phase == 0) != (rho > Rho_c)) {
+                    cellError = 1.0;
+                    break;
+                }
+                cellError = std::max(cellError, fabs(exp(lnRho) - rho) / rho);
+            }
+            if (cellError > m_rtol) {
+                cellOK[k] = 0;
+            } else {
+                m_maxError = std::max(m_maxError, cellError);
+            }
+        }
+    }
+}
+
+void WaterPropsIAPWSTable::buildSaturation()
+{
+    WaterPropsIAPWS water;
+    m_lnPsat.resize(m_nT);
+    m_dlnPsat.resize(m_nT);
+    m_satOK.assign(m_nT, 0);
+    for (size_t phase = 0; phase < 2; phase++) {
+        m_lnRhoSat[phase].resize(m_nT);
+        m_dlnRhoSat[phase].resize(m_nT);
+    }
+
+    for (size_t i = 0; i < m_nT; i++) {
+        doublereal T = m_Tmin + i * m_dT;
+        doublereal p = water.psat(T, WATER_LIQUID);
+        doublereal rho[2], h[2], v[2], dlnrho_dT[2], dlnrho_dlnP[2];
+        rho[0] = water.density();
+        rho[1] = water.density(T, p, WATER_GAS);
+        for (size_t phase = 0; phase < 2; phase++) {
+            water.setState_TR(T, rho[phase]);
+            h[phase] = water.enthalpy();
+            v[phase] = water.molarVolume();
+            dlnrho_dT[phase] = - water.coeffThermExp();
+            dlnrho_dlnP[phase] = p * water.isothermalCompressibility();
+        }
+
+        // Clausius-Clapeyron equation for the slope of the saturation curve
+        m_lnPsat[i] = log(p);
+        m_dlnPsat[i] = (h[1] - h[0]) / (T * (v[1] - v[0]) * p);
+        for (size_t phase = 0; phase < 2; phase++) {
+            m_lnRhoSat[phase][i] = log(rho[phase]);
+            m_dlnRhoSat[phase][i] = dlnrho_dT[phase]
+                                    + dlnrho_dlnP[phase] * m_dlnPsat[i];
+        }
+    }
+
+    for (size_t i = 0; i + 1 < m_nT; i++) {
+        m_satOK[i] = 1;
+        doublereal T = m_Tmin + (i + 0.5) * m_dT;
+        doublereal p = water.psat(T, WATER_LIQUID);
+        doublereal rhoLiq = water.density();
+        doublereal rhoGas = water.density(T, p, WATER_GAS);
+        doublereal pTable, rhoLiqTable, rhoGasTable;
+        pTable = psat(T, rhoLiqTable, rhoGasTable);
+        doublereal err = std::max(fabs(pTable - p) / p,
+                                  fabs(rhoLiqTable - rhoLiq) / rhoLiq);
+        err = std::max(err, fabs(rhoGasTable - rhoGas) / rhoGas);
+        if (err > m_rtol) {
+            m_satOK[i] = 0;
+        } else {
+            m_maxError = std::max(m_maxError, err);
+        }
+    }
+    m_satOK[m_nT - 1] = 0;
+}
+
+bool WaterPropsIAPWSTable::interpolate(size_t phase, doublereal T,
+                                       doublereal lnP, doublereal& value) const
+{
+    if (T < m_Tmin || T > m_Tmax || lnP < m_lnPmin || lnP > m_lnPmax) {
+        return false;
+    }
+    size_t i = std::min(size_t((T - m_Tmin) / m_dT), m_nT - 2);
+    size_t j = std::min(size_t((lnP - m_lnPmin) / m_dlnP), m_nP - 2);
+    size_t k = i * m_nP + j;
+    if (!m_cellOK[phase][k]) {
+        return false;
+    }
+
+    doublereal hT[4], hP[4];
+    hermiteBasis((T - m_Tmin) / m_dT - i, hT);
+    hermiteBasis((lnP - m_lnPmin) / m_dlnP - j, hP);
+    const doublereal* f = &m_lnRho[phase][0];
+    const doublereal* fT = &m_dT_lnRho[phase][0];
+    const doublereal* fP = &m_dP_lnRho[phase][0];
+    const doublereal* fTP = &m_dTP_lnRho[phase][0];
+    value = 0.0;
+    for (size_t a = 0; a < 2; a++) {
+        for (size_t b = 0; b < 2; b++) {
+            size_t n = k + a * m_nP + b;
+            value += hT[a] * hP[b] * f[n]
+                     + m_dT * hT[a+2] * hP[b] * fT[n]
+                     + m_dlnP * hT[a] * hP[b+2] * fP[n]
+                     + m_dT * m_dlnP * hT[a+2] * hP[b+2] * fTP[n];
+        }
+    }
+    return true;
+}
+
+doublereal WaterPropsIAPWSTable::density(doublereal T, doublereal P,
+                                         int phase) const
+{
+    if (P <= 0.0 || (phase != WATER_LIQUID && phase != WATER_GAS)) {
+        return -1.0;
+    }
+    doublereal lnRho;
+    if (interpolate((phase == WATER_LIQUID) ? 0 : 1, T, log(P), lnRho)) {
+        return exp(lnRho);
+    }
+    return -1.0;
+}
+
+doublereal WaterPropsIAPWSTable::psat(doublereal T, doublereal& densLiq,
+                                      doublereal& densGas) const
+{
+    if (T < m_Tmin || T > m_Tmax) {
+        return -1.0;
+    }
+    size_t i = std::min(size_t((T - m_Tmin) / m_dT), m_nT - 2);
+    if (!m_satOK[i]) {
+        return -1.0;
+    }
+    doublereal h[4];
+    hermiteBasis((T - m_Tmin) / m_dT - i, h);
+    densLiq = exp(h[0] * m_lnRhoSat[0][i] + h[1] * m_lnRhoSat[0][i+1]
+                  + m_dT * (h[2] * m_dlnRhoSat[0][i] + h[3] * m_dlnRhoSat[0][i+1]));
+    densGas = exp(h[0] * m_lnRhoSat[1][i] + h[1] * m_lnRhoSat[1][i+1]
+                  + m_dT * (h[2] * m_dlnRhoSat[1][i] + h[3] * m_dlnRhoSat[1][i+1]));
+    return exp(h[0] * m_lnPsat[i] + h[1] * m_lnPsat[i+1]
+               + m_dT * (h[2] * m_dlnPsat[i] + h[3] * m_dlnPsat[i+1]));
+}
+
+doublereal WaterPropsIAPWSTable::coverage() const
+{
+    size_t nUsed = 0;
+    for (size_t phase = 0; phase < 2; phase++) {
+        for (size_t k = 0; k < m_cellOK[phase].size(); k++) {
+            nUsed += m_cellOK[phase][k];
+        }
+    }
+    return nUsed / (2.0 * (m_nT - 1) * (m_nP - 1));
+}
+
+const WaterPropsIAPWSTable& WaterPropsIAPWSTable::defaultTable()
+{
+    static WaterPropsIAPWSTable table;
+    return table;
+}
+
+}
@@ -1100,6 +1100,35 @@ doublereal  WaterPropsIAPWSphi::dfind(doublereal  p_red, doublereal  tau, double
     return dd;
 }
 
+doublereal WaterPropsIAPWSphi::dfindNewton(doublereal p_red, doublereal tau,
+                                           doublereal deltaGuess)
+{
+    doublereal dd = deltaGuess;
+    doublereal pcheck = 1.0E-30 + 1.0E-8 * p_red;
+    for (int n = 0; n < 8; n++) {
+        tdpolycalc(tau, dd);
+        doublereal q1 = phiR_d();
+        doublereal q2 = phiR_dd();
+        doublereal pred0 = dd + dd * dd * q1;
+        doublereal dpddelta = 1.0 + 2.0 * dd * q1 + dd * dd * q2;
+        if (dpddelta <= 0.0) {
+            return 0.0;
+        }
+        if (fabs(pred0-p_red) < pcheck) {
+            return dd;
+        }
+        doublereal deldd = - (pred0 - p_red) / dpddelta;
+        dd += deldd;
+        if (fabs(deldd/dd) < 1.0E-14) {
+            return dd;
+        }
+        if (dd <= 0.0) {
+            return 0.0;
+        }
+    }
+    return 0.0;
+}
+
 doublereal  WaterPropsIAPWSphi::gibbs_RT() const
 {
     doublereal  delta = DELTAsave;
@@ -21,7 +21,9 @@ Substance::Substance() :
     Pst(Undef),
     m_energy_offset(0.0),
     m_entropy_offset(0.0),
-    kbr(0)
+    kbr(0),
+    m_satT0(0.0),
+    m_satDT(0.0)
 {
 }
 
@@ -77,7 +79,10 @@ double Substance::Tsat(double p)
     int LoopCount = 0;
     double tol = 1.e-6*p;
     double Tsave = T;
-    if (T < Tmin()) {
+    double Tguess = satTableTsat(p);
+    if (Tguess > 0.0) {
+        T = Tguess;
+    } else if (T < Tmin()) {
         T = 0.5*(Tcrit() - Tmin());
     }
     if (T >= Tcrit()) {
@@ -249,6 +254,72 @@ void Substance::Set(PropertyPair::type XY, double x0, double y0)
     }
 }
 
+void Substance::setStates(PropertyPair::type XY, size_t n, const double* x0,
+                          const double* y0, double* t, double* v)
+{
+    if (!hasSatTable()) {
+        buildSatTable();
+    }
+    for (size_t i = 0; i < n; i++) {
+        try {
+            Set(XY, x0[i], y0[i]);
+        } catch (CanteraError& err) {
+            throw TPX_Error("Substance::setStates", "Failed to set state " +
+                            int2str(i) + ":\n" + err.getMessage());
+        }
+        t[i] = T;
+        v[i] = 1.0/Rho;
+    }
+}
+
+void Substance::buildSatTable(size_t nT)
+{
+    if (nT < 2) {
+        throw TPX_Error("Substance::buildSatTable",
+                        "At least two temperatures are needed");
+    }
+    double Tsave = T;
+    double Rhosave = Rho;
+    double dT = (Tcrit() - Tmin())/nT;
+
+    // Discard any existing table so that it is not used to compute the new
+    // one. The table covers the longest range of temperatures, starting from
+    // Tmin(), over which the saturation state can be computed.
+    m_satDT = 0.0;
+    m_satLnP.clear();
+    m_satRhf.clear();
+    m_satLnRhv.clear();
+    std::vector<double> lnP, rhf, lnRhv;
+    double T0 = Tmin();
+    for (size_t i = 0; i < nT; i++) {
+        T = Tmin() + i*dT;
+        Tslast = Undef;
+        try {
+            update_sat();
+        } catch (TPX_Error&) {
+            if (lnP.empty()) {
+                T0 = T + dT;
+                continue;
+            }
+            break;
+        }
+        lnP.push_back(log(Pst));
+        rhf.push_back(Rhf);
+        lnRhv.push_back(log(Rhv));
+    }
+    T = Tsave;
+    Rho = Rhosave;
+    Tslast = Undef;
+
+    if (lnP.size() > 1) {
+        m_satT0 = T0;
+        m_satDT = dT;
+        m_satLnP.swap(lnP);
+        m_satRhf.swap(rhf);
+        m_satLnRhv.swap(lnRhv);
+    }
+}
+
 //------------------ Protected and Private Functions -------------------
 
 void Substance::set_Rho(double r0)
@@ -294,14 +365,18 @@ void Substance::update_sat()
     if ((T != Tslast) && (T < Tcrit())) {
         double Rho_save = Rho;
 
-        double pp = Psat();
+        double pp, rhf0, rhv0;
+        if (!satTableEstimate(T, pp, rhf0, rhv0)) {
+            pp = Psat(); // trial value = Psat from correlation
+            rhf0 = ldens(); // trial value = liquid density
+            rhv0 = pp*MolWt()/(8314.0*T); // trial value = ideal gas
+        }
         double lps = log(pp);
-        // trial value = Psat from correlation
         int i;
 
         for (i = 0; i<20; i++) {
             if (i==0) {
-                Rho = ldens(); // trial value = liquid density
+                Rho = rhf0;
             } else {
                 Rho = Rhf;
             }
@@ -310,7 +385,7 @@ void Substance::update_sat()
 
             double gf = hp() - T*sp();
             if (i==0) {
-                Rho = pp*MolWt()/(8314.0*T); // trial value = ideal gas
+                Rho = rhv0;
             } else {
                 Rho = Rhv;
             }
@@ -361,6 +436,44 @@ void Substance::update_sat()
     }
 }
 
+bool Substance::satTableEstimate(double t, double& ps, double& rhf,
+                                 double& rhv)
+{
+    if (m_satLnP.size() < 2) {
+        return false;
+    }
+    double r = (t - m_satT0)/m_satDT;
+    if (r < 0.0 || r >= m_satLnP.size() - 1) {
+        return false;
+    }
+    size_t i = static_cast<size_t>(r);
+    double T1 = m_satT0 + i*m_satDT;
+    double T2 = T1 + m_satDT;
+    double f = (1.0/t - 1.0/T1)/(1.0/T2 - 1.0/T1);
+    ps = exp(m_satLnP[i] + f*(m_satLnP[i+1] - m_satLnP[i]));
+    rhv = exp(m_satLnRhv[i] + f*(m_satLnRhv[i+1] - m_satLnRhv[i]));
+    rhf = m_satRhf[i] + (r - i)*(m_satRhf[i+1] - m_satRhf[i]);
+    return true;
+}
+
+double Substance::satTableTsat(double p)
+{
+    if (m_satLnP.size() < 2) {
+        return -1.0;
+    }
+    double lnp = log(p);
+    std::vector<double>::const_iterator loc =
+        std::upper_bound(m_satLnP.begin(), m_satLnP.end(), lnp);
+    if (loc == m_satLnP.begin() || loc == m_satLnP.end()) {
+        return -1.0;
+    }
+    size_t i = loc - m_satLnP.begin() - 1;
+    double T1 = m_satT0 + i*m_satDT;
+    double T2 = T1 + m_satDT;
+    double f = (lnp - m_satLnP[i])/(m_satLnP[i+1] - m_satLnP[i]);
+    return 1.0/(1.0/T1 + f*(1.0/T2 - 1.0/T1));
+}
+
 double Substance::vprop(propertyFlag::type ijob)
 {
     switch (ijob) {
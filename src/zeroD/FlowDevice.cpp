@@ -43,6 +43,11 @@ bool FlowDevice::install(ReactorBase& in, ReactorBase& out)
 void FlowDevice::setFunction(Func1* f)
 {
     m_func = f;
+    if (f) {
+        m_funcCode.compile(*f);
+    } else {
+        m_funcCode.clear();
+    }
 }
 
 doublereal FlowDevice::outletSpeciesMassFlowRate(size_t k)
@@ -133,6 +133,19 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+size_t IdealGasConstPressureReactor::energyRateDerivs(double* dEdw)
+{
+    if (!m_energy) {
+        return npos;
+    }
+    m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+    double c = - m_vol / (m_mass * m_thermo->cp_mass());
+    for (size_t k = 0; k < m_nsp; k++) {
+        dEdw[k] = c * m_hk[k];
+    }
+    return 1;
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
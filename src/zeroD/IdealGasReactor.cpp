@@ -150,6 +150,19 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+size_t IdealGasReactor::energyRateDerivs(double* dEdw)
+{
+    if (!m_energy) {
+        return npos;
+    }
+    m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+    double c = - m_vol / (m_mass * m_thermo->cv_mass());
+    for (size_t k = 0; k < m_nsp; k++) {
+        dEdw[k] = c * m_uk[k];
+    }
+    return 2;
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -338,6 +338,44 @@ void Reactor::addSensitivityReaction(size_t rxn)
     m_mult_save.push_back(1.0);
 }
 
+size_t Reactor::evalReactionParamDerivs(double* dfdp, size_t ld)
+{
+    size_t npar = m_pnum.size();
+    for (size_t n = 0; n < npar; n++) {
+        fill(dfdp + n*ld, dfdp + n*ld + m_nv, 0.0);
+    }
+    if (!m_chem || npar == 0) {
+        return npar;
+    }
+
+    m_thermo->restoreState(m_state);
+    vector_fp ropnet(m_kin->nReactions());
+    m_kin->getNetRatesOfProgress(&ropnet[0]);
+    vector_fp dEdw(m_nsp);
+    size_t kE = energyRateDerivs(&dEdw[0]);
+    size_t kY = componentIndex(m_thermo->speciesName(0));
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double rrho = 1.0 / m_thermo->density();
+
+    const StoichMatrix& nu = m_kin->netStoichCoeffs();
+    const std::vector<size_t>& start = nu.colStart();
+    const std::vector<size_t>& species = nu.rowIndex();
+    const vector_fp& coeffs = nu.colValues();
+    for (size_t n = 0; n < npar; n++) {
+        size_t i = m_pnum[n];
+        double* col = dfdp + n*ld;
+        for (size_t j = start[i]; j < start[i+1]; j++) {
+            size_t k = species[j];
+            double dwdot = coeffs[j] * ropnet[i];
+            col[kY + k] = dwdot * mw[k] * rrho;
+            if (kE != npos) {
+                col[kE] += dwdot * dEdw[k];
+            }
+        }
+    }
+    return npar;
+}
+
 std::vector<std::pair<void*, int> > Reactor::getSensitivityOrder() const
 {
     std::vector<std::pair<void*, int> > order;
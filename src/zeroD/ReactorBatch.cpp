@@ -0,0 +1,287 @@
+//! @file ReactorBatch.cpp
+#include "cantera/zeroD/ReactorBatch.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/base/stringUtils.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Cantera
+{
+
+//! The objects used by one thread of a ReactorBatch to integrate its cells
+class BatchWorker
+{
+public:
+    BatchWorker(const string& infile, const string& id, const string& type) :
+        thermo(0), kin(0), reactor(0), dt(-1.0), ncells(0)
+    {
+        XML_Node* root = get_XML_File(infile);
+        XML_Node* xphase = get_XML_NameID("phase", "#"+id, root);
+        if (!xphase) {
+            throw CanteraError("ReactorBatch", "Couldn't find phase named \""
+                               + id + "\" in file, " + infile);
+        }
+        ReactorBase* r = newReactor(type);
+        reactor = dynamic_cast<Reactor*>(r);
+        if (!reactor) {
+            delete r;
+            throw CanteraError("ReactorBatch", "Reactor type '" + type +
+                               "' cannot be integrated");
+        }
+        try {
+            thermo = newPhase(*xphase);
+            vector<ThermoPhase*> phases(1, thermo);
+            kin = newKineticsMgr(*xphase, phases);
+            reactor->setThermoMgr(*thermo);
+            reactor->setKineticsMgr(*kin);
+        } catch (...) {
+            delete reactor;
+            delete kin;
+            delete thermo;
+            throw;
+        }
+        net.addReactor(*reactor);
+    }
+
+    ~BatchWorker() {
+        delete reactor;
+        delete kin;
+        delete thermo;
+    }
+
+    //! Advance the state *y* of one cell by time *dt_*.
+    //! @returns the number of right-hand side evaluations
+    int advance(double* y, double dt_) {
+        thermo->setState_TPY(y[0], y[1], y+2);
+        // Start from the same volume for every cell, rather than the final
+        // volume of the previous one, so that the results do not depend on
+        // which cells were integrated before by this worker
+        reactor->setInitialVolume(1.0);
+        reactor->syncState();
+        if (dt_ != dt) {
+            net.setMaxTimeStep(dt_);
+            dt = dt_;
+        }
+        net.setInitialTime(0.0);
+        net.advance(dt);
+        y[0] = thermo->temperature();
+        y[1] = thermo->pressure();
+        thermo->getMassFractions(y+2);
+        return net.integrator().nEvals();
+    }
+
+    ThermoPhase* thermo;
+    Kinetics* kin;
+    Reactor* reactor;
+    ReactorNet net;
+    double dt; //!< time step of the last cell
+    size_t ncells; //!< number of cells integrated in the current batch
+
+private:
+    BatchWorker(const BatchWorker&);
+    BatchWorker& operator=(const BatchWorker&);
+};
+
+namespace {
+
+//! Sorts cell indices by decreasing cost
+struct CostOrder {
+    explicit CostOrder(const vector<int>& cost_) : cost(cost_) {}
+    bool operator()(size_t i, size_t j) const {
+        return cost[i] > cost[j];
+    }
+    const vector<int>& cost;
+};
+
+}
+
+ReactorBatch::ReactorBatch(const std::string& infile, const std::string& id,
+                           const std::string& reactorType) :
+    m_infile(infile),
+    m_id(id),
+    m_reactorType(reactorType),
+    m_nsp(0),
+    m_chunk(4),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_energy(true),
+    m_integType("CVODE"),
+    m_state(0),
+    m_dt(0.0),
+    m_next(0),
+    m_failedCell(npos)
+{
+    setThreads(1);
+    m_nsp = m_workers[0]->thermo->nSpecies();
+}
+
+ReactorBatch::~ReactorBatch()
+{
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        delete m_workers[n];
+    }
+}
+
+void ReactorBatch::setThreads(size_t n)
+{
+    if (n == 0) {
+        throw CanteraError("ReactorBatch::setThreads",
+                           "At least one thread is required");
+    }
+    while (m_workers.size() > n) {
+        delete m_workers.back();
+        m_workers.pop_back();
+    }
+    while (m_workers.size() < n) {
+        BatchWorker* w = new BatchWorker(m_infile, m_id, m_reactorType);
+        w->net.setTolerances(m_rtol, m_atol);
+        w->net.setIntegratorType(m_integType);
+        w->reactor->setEnergy(m_energy);
+        m_workers.push_back(w);
+    }
+}
+
+void ReactorBatch::setChunkSize(size_t n)
+{
+    m_chunk = std::max<size_t>(n, 1);
+}
+
+void ReactorBatch::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        m_workers[n]->net.setTolerances(rtol, atol);
+    }
+}
+
+void ReactorBatch::setEnergy(bool enable)
+{
+    m_energy = enable;
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        m_workers[n]->reactor->setEnergy(enable);
+    }
+}
+
+void ReactorBatch::setIntegratorType(const std::string& type)
+{
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        m_workers[n]->net.setIntegratorType(type);
+    }
+    m_integType = type;
+}
+
+void ReactorBatch::advance(size_t ncells, double* state, double dt)
+{
+    // Start the most expensive cells from the last time step first
+    m_order.resize(ncells);
+    for (size_t i = 0; i < ncells; i++) {
+        m_order[i] = i;
+    }
+    if (m_cost.size() == ncells) {
+        std::stable_sort(m_order.begin(), m_order.end(), CostOrder(m_cost));
+    } else {
+        m_cost.assign(ncells, 0);
+    }
+
+    m_state = state;
+    m_dt = dt;
+    m_next = 0;
+    m_failedCell = npos;
+    m_failure = "";
+
+    size_t nthreads = m_workers.size();
+    vector<ThreadArgs> args(nthreads);
+    vector<thread_t*> threads;
+    try {
+        for (size_t n = 1; n < nthreads; n++) {
+            args[n].batch = this;
+            args[n].n = n;
+            threads.push_back(new thread_t(runWorker, &args[n]));
+        }
+        // The calling thread is used as the first worker
+        work(0);
+    } catch (...) {
+        // Stop handing out cells, and wait for the threads that were started,
+        // since they use *args* and the state array
+        {
+            ScopedLock lock(m_mutex);
+            m_next = m_order.size();
+        }
+        joinThreads(threads);
+        m_state = 0;
+        throw;
+    }
+    joinThreads(threads);
+
+    m_ncells.resize(nthreads);
+    for (size_t n = 0; n < nthreads; n++) {
+        m_ncells[n] = m_workers[n]->ncells;
+    }
+    m_state = 0;
+    if (m_failedCell != npos) {
+        throw CanteraError("ReactorBatch::advance", "Integration failed for "
+                           "cell " + int2str(m_failedCell) + ":\n" + m_failure);
+    }
+}
+
+void ReactorBatch::joinThreads(vector<thread_t*>& threads)
+{
+    for (size_t n = 0; n < threads.size(); n++) {
+        threads[n]->join();
+        delete threads[n];
+    }
+    threads.clear();
+}
+
+void ReactorBatch::runWorker(void* args)
+{
+    ThreadArgs* a = static_cast<ThreadArgs*>(args);
+    a->batch->work(a->n);
+}
+
+bool ReactorBatch::nextChunk(size_t& begin, size_t& end)
+{
+    ScopedLock lock(m_mutex);
+    if (m_next >= m_order.size()) {
+        return false;
+    }
+    begin = m_next;
+    end = std::min(m_next + m_chunk, m_order.size());
+    m_next = end;
+    return true;
+}
+
+void ReactorBatch::work(size_t n)
+{
+    BatchWorker& w = *m_workers[n];
+    w.ncells = 0;
+    size_t stateSize = m_nsp + 2;
+    vector_fp y(stateSize);
+    size_t begin, end;
+    while (nextChunk(begin, end)) {
+        for (size_t j = begin; j < end; j++) {
+            size_t i = m_order[j];
+            double* state = m_state + i * stateSize;
+            std::copy(state, state + stateSize, y.begin());
+            try {
+                m_cost[i] = w.advance(&y[0], m_dt);
+                std::copy(y.begin(), y.end(), state);
+            } catch (std::exception& err) {
+                ScopedLock lock(m_mutex);
+                if (i < m_failedCell) {
+                    m_failedCell = i;
+                    m_failure = err.what();
+                }
+            }
+            w.ncells++;
+        }
+    }
+}
+
+}
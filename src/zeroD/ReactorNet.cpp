@@ -1,30 +1,323 @@
 //! @file ReactorNet.cpp
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorRecorder.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
+#include "cantera/numerics/ctlapack.h"
 
 #include <cstdio>
+#include <limits>
+#include <deque>
 
 using namespace std;
 
 namespace Cantera
 {
 
+//! Cubic Hermite interpolation between the values *y0* and *y1* with time
+//! derivatives *ydot0* and *ydot1* at the ends of an interval of length *h*.
+//! *s* is the fractional position in the interval.
+static void hermite(const vector_fp& y0, const vector_fp& ydot0,
+                    const vector_fp& y1, const vector_fp& ydot1,
+                    double h, double s, double* y)
+{
+    double s2 = s*s;
+    double s3 = s2*s;
+    double h00 = 2*s3 - 3*s2 + 1;
+    double h10 = (s3 - 2*s2 + s) * h;
+    double h01 = -2*s3 + 3*s2;
+    double h11 = (s3 - s2) * h;
+    for (size_t k = 0; k < y0.size(); k++) {
+        y[k] = h00*y0[k] + h10*ydot0[k] + h01*y1[k] + h11*ydot1[k];
+    }
+}
+
+//! The forward problem integrated from a checkpoint by AdjointFunc
+class CheckpointFunc : public FuncEval
+{
+public:
+    CheckpointFunc(ReactorNet& net, size_t nparams) :
+        m_net(net), m_params(nparams, 1.0), m_y0(net.neq()) {}
+
+    virtual size_t neq() {
+        return m_y0.size();
+    }
+
+    virtual void getInitialConditions(double t0, size_t leny, double* y) {
+        copy(m_y0.begin(), m_y0.end(), y);
+    }
+
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        m_net.eval(t, y, ydot, DATA_PTR(m_params));
+    }
+
+    ReactorNet& m_net;
+    vector_fp m_params; //!< unperturbed sensitivity parameters
+    vector_fp m_y0; //!< state at the checkpoint
+};
+
+//! The adjoint equations solved by ReactorNet::advanceAdjoint().
+/*!
+ *  The equations are written in terms of the reversed time
+ *  \f$ \tau = t_f - t \f$ so that they can be integrated forward in
+ *  \f$ \tau \f$ by a standard Integrator:
+ *
+ *  \f[ \frac{d\lambda}{d\tau} = J^T \lambda + b \f]
+ *
+ *  During the forward integration, the state is saved at a checkpoint every
+ *  *interval* steps, and the state after each step is stored only for the
+ *  last two checkpoint intervals. The backward integration proceeds one
+ *  interval at a time, and loadInterval() recomputes the forward solution of
+ *  the preceding interval from its checkpoint, so that the forward solution
+ *  is available if the backward integrator steps past the start of the
+ *  current interval.
+ *
+ *  The forward solution is interpolated between the stored states. The
+ *  Jacobian is evaluated by finite differences at each stored state the
+ *  first time it is needed, and is linearly interpolated within each step.
+ */
+class AdjointFunc : public FuncEval
+{
+public:
+    AdjointFunc(ReactorNet& net, size_t nparams, double t0, double tf,
+                const vector_fp& a, const vector_fp& b, size_t interval,
+                Integrator& integ) :
+        m_net(net), m_nv(net.neq()), m_t0(t0), m_tf(tf), m_a(a), m_b(b),
+        m_params(nparams, 1.0), m_interval(std::max<size_t>(interval, 1)),
+        m_nsteps(0), m_ymax(m_nv, 0.0), m_ydotmax(m_nv, 0.0),
+        m_integ(integ), m_forward(net, nparams), m_y(m_nv), m_ydot(m_nv)
+    {
+        m_a.resize(m_nv, 0.0);
+        m_b.resize(m_nv, 0.0);
+    }
+
+    //! Store the forward solution *y* at time *t*, which must be greater
+    //! than the time of the last point added. Called after each step of the
+    //! forward integration.
+    void addPoint(double t, const double* y) {
+        if (m_nsteps % m_interval == 0) {
+            // Start a new interval, and drop the stored points before the
+            // start of the previous one
+            if (!m_ckTimes.empty()) {
+                while (m_points.front().t < m_ckTimes.back()) {
+                    m_points.pop_front();
+                }
+            }
+            m_ckTimes.push_back(t);
+            m_ckY.push_back(vector_fp(y, y + m_nv));
+        }
+        m_points.push_back(Point());
+        storePoint(m_points.back(), t, y);
+        for (size_t k = 0; k < m_nv; k++) {
+            m_ymax[k] = std::max(m_ymax[k], fabs(y[k]));
+            m_ydotmax[k] = std::max(m_ydotmax[k],
+                                    fabs(m_points.back().ydot[k]));
+        }
+        m_nsteps++;
+    }
+
+    //! Finish the forward integration, after the point at *tf* is added
+    void finish() {
+        if (m_ckTimes.size() > 1 && m_ckTimes.back() == m_tf) {
+            m_ckTimes.pop_back();
+            m_ckY.pop_back();
+        }
+    }
+
+    //! Number of checkpoint intervals
+    size_t nIntervals() const {
+        return m_ckTimes.size();
+    }
+
+    //! Time at the start of interval *k*
+    double startTime(size_t k) const {
+        return m_ckTimes[k];
+    }
+
+    //! Time at the end of interval *k*
+    double endTime(size_t k) const {
+        return (k + 1 < m_ckTimes.size()) ? m_ckTimes[k+1] : m_tf;
+    }
+
+    //! Make the stored forward solution cover interval *k* and the one before
+    //! it, recomputing it if necessary, and drop the points after interval *k*
+    void loadInterval(size_t k) {
+        double tend = endTime(k);
+        while (m_points.back().t > tend) {
+            m_points.pop_back();
+        }
+        size_t kfirst = (k > 0) ? k - 1 : 0;
+        size_t j = std::lower_bound(m_ckTimes.begin(), m_ckTimes.end(),
+                                    m_points.front().t) - m_ckTimes.begin();
+        while (j > kfirst) {
+            recompute(--j);
+        }
+    }
+
+    //! Index of the stored point at time *t*
+    size_t pointIndex(double t) const {
+        return std::lower_bound(m_points.begin(), m_points.end(), t,
+                                compareTime) - m_points.begin();
+    }
+
+    double time(size_t j) const {
+        return m_points[j].t;
+    }
+
+    //! Largest magnitude of each solution component
+    const vector_fp& maxSolution() const {
+        return m_ymax;
+    }
+
+    //! Largest magnitude of the time derivative of each solution component
+    const vector_fp& maxDerivative() const {
+        return m_ydotmax;
+    }
+
+    //! Interpolate the forward solution at time *t*.
+    void interpolate(double t, double* y) const {
+        double x;
+        size_t j = findStep(t, x);
+        const Point& p0 = m_points[j];
+        const Point& p1 = m_points[j+1];
+        hermite(p0.y, p0.ydot, p1.y, p1.ydot, p1.t - p0.t, x, y);
+    }
+
+    //! Magnitude of the output for a solution component that varies over
+    //! the range of *yscale*, used to set the adjoint tolerances.
+    double outputScale(const vector_fp& yscale) const {
+        double scale = 0.0;
+        for (size_t k = 0; k < m_nv; k++) {
+            scale += (fabs(m_a[k]) + fabs(m_b[k]) * (m_tf - m_t0)) * yscale[k];
+        }
+        return scale;
+    }
+
+    virtual size_t neq() {
+        return m_nv;
+    }
+
+    virtual void getInitialConditions(double t0, size_t leny, double* lambda) {
+        copy(m_a.begin(), m_a.end(), lambda);
+    }
+
+    virtual void eval(double tau, double* lambda, double* dlambda, double* p) {
+        double x;
+        size_t j = findStep(m_tf - tau, x);
+        const Array2D& jac0 = jacobian(j);
+        const Array2D& jac1 = jacobian(j+1);
+        for (size_t i = 0; i < m_nv; i++) {
+            double sum0 = 0.0;
+            double sum1 = 0.0;
+            for (size_t k = 0; k < m_nv; k++) {
+                sum0 += jac0(k,i) * lambda[k];
+                sum1 += jac1(k,i) * lambda[k];
+            }
+            dlambda[i] = m_b[i] + (1 - x) * sum0 + x * sum1;
+        }
+    }
+
+protected:
+    //! A stored state of the forward solution
+    struct Point {
+        double t;
+        vector_fp y;
+        vector_fp ydot;
+        Array2D jac; //!< Jacobian, once evaluated
+    };
+
+    static bool compareTime(const Point& p, double t) {
+        return p.t < t;
+    }
+
+    void storePoint(Point& p, double t, const double* y) {
+        p.t = t;
+        p.y.assign(y, y + m_nv);
+        p.ydot.resize(m_nv);
+        m_net.eval(t, &p.y[0], &p.ydot[0], DATA_PTR(m_params));
+    }
+
+    //! Integrate the forward solution from the checkpoint at the start of
+    //! interval *k* to the start of the stored points, which is the end of
+    //! interval *k*, and add the states after each step.
+    void recompute(size_t k) {
+        double tout = m_ckTimes[k+1];
+        m_forward.m_y0 = m_ckY[k];
+        m_integ.initialize(m_ckTimes[k], m_forward);
+        std::deque<Point> points(1);
+        storePoint(points.back(), m_ckTimes[k], &m_ckY[k][0]);
+        while (true) {
+            double t = m_integ.step(tout);
+            if (t >= tout) {
+                break;
+            }
+            points.push_back(Point());
+            storePoint(points.back(), t, m_integ.solution());
+        }
+        m_points.insert(m_points.begin(), points.begin(), points.end());
+    }
+
+    //! Find the step of the forward solution containing time *t*. Returns
+    //! the index *j* of the start of the step, and sets *x* to the
+    //! fractional position of *t* within [t_j, t_j+1].
+    size_t findStep(double t, double& x) const {
+        t = std::min(std::max(t, m_points.front().t), m_points.back().t);
+        size_t j = pointIndex(t);
+        j = std::min(std::max(j, (size_t) 1), m_points.size() - 1) - 1;
+        x = (t - m_points[j].t) / (m_points[j+1].t - m_points[j].t);
+        return j;
+    }
+
+    //! Jacobian of the forward problem at stored point *j*, evaluated the
+    //! first time it is needed
+    const Array2D& jacobian(size_t j) {
+        Point& p = m_points[j];
+        if (p.jac.nRows() == 0) {
+            p.jac.resize(m_nv, m_nv);
+            m_y = p.y;
+            m_net.evalJacobian(p.t, &m_y[0], &m_ydot[0], DATA_PTR(m_params),
+                               &p.jac);
+        }
+        return p.jac;
+    }
+
+    ReactorNet& m_net;
+    size_t m_nv;
+    double m_t0;
+    double m_tf;
+    vector_fp m_a;
+    vector_fp m_b;
+    vector_fp m_params; //!< unperturbed sensitivity parameters
+
+    size_t m_interval; //!< number of steps between checkpoints
+    size_t m_nsteps; //!< number of steps of the forward integration
+    vector_fp m_ckTimes; //!< times of the checkpoints
+    std::vector<vector_fp> m_ckY; //!< forward solution at the checkpoints
+    vector_fp m_ymax; //!< largest magnitude of each solution component
+    vector_fp m_ydotmax; //!< largest magnitude of each time derivative
+
+    //! Stored states, covering at most two checkpoint intervals
+    std::deque<Point> m_points;
+
+    Integrator& m_integ; //!< integrator used to recompute the forward solution
+    CheckpointFunc m_forward;
+    vector_fp m_y;
+    vector_fp m_ydot;
+};
+
 ReactorNet::ReactorNet() :
-    m_integ(0), m_time(0.0), m_init(false), m_integrator_init(false),
+    m_integ(0), m_adjointInteg(0), m_checkpointInteg(0),
+    m_adjointInterval(50), m_time(0.0), m_init(false),
+    m_integrator_init(false),
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-4),
     m_maxstep(-1.0), m_maxErrTestFails(0),
-    m_verbose(false), m_ntotpar(0)
+    m_verbose(false), m_forwardSens(true), m_sensEquations(false),
+    m_ntotpar(0),
+    m_recorder(0), m_lastEvent(npos), m_event_t(0.0), m_sens_t(0.0),
+    m_ss_dt(1.0e-5), m_ss_nsteps(10), m_ss_maxiter(50)
 {
-    m_integ = newIntegrator("CVODE");
-
-    // use backward differencing, with a full Jacobian computed
-    // numerically, and use a Newton linear iterator
-
-    m_integ->setMethod(BDF_Method);
-    m_integ->setProblemType(DENSE + NOJAC);
-    m_integ->setIterator(Newton_Iter);
+    setIntegratorType("CVODE");
 }
 
 ReactorNet::~ReactorNet()
@@ -36,6 +329,24 @@ ReactorNet::~ReactorNet()
         m_reactors[n] = 0;
     }
     delete m_integ;
+    delete m_adjointInteg;
+    delete m_checkpointInteg;
+}
+
+void ReactorNet::setIntegratorType(const std::string& type)
+{
+    Integrator* integ = newIntegrator(type);
+    if (type == "CVODE") {
+        // use backward differencing, with a full Jacobian computed
+        // numerically, and use a Newton linear iterator
+        integ->setMethod(BDF_Method);
+        integ->setProblemType(DENSE + NOJAC);
+        integ->setIterator(Newton_Iter);
+    }
+    delete m_integ;
+    m_integ = integ;
+    m_integType = type;
+    m_init = false;
 }
 
 void ReactorNet::initialize()
@@ -49,6 +360,8 @@ void ReactorNet::initialize()
                            "no reactors in network!");
     size_t sensParamNumber = 0;
     m_start.assign(1, 0);
+    m_nparams.clear();
+    m_componentIndex.assign(m_reactors.size(), std::map<std::string, size_t>());
     for (n = 0; n < m_reactors.size(); n++) {
         Reactor& r = *m_reactors[n];
         r.initialize(m_time);
@@ -97,6 +410,7 @@ void ReactorNet::initialize()
     m_integ->initialize(m_time, *this);
     m_integrator_init = true;
     m_init = true;
+    m_event_g.clear();
 }
 
 void ReactorNet::reinitialize()
@@ -105,6 +419,7 @@ void ReactorNet::reinitialize()
         writelog("Re-initializing reactor network.\n", m_verbose);
         m_integ->reinitialize(m_time, *this);
         m_integrator_init = true;
+        m_event_g.clear();
     } else {
         initialize();
     }
@@ -120,9 +435,34 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    if (m_recorder) {
+        recordSteps(time);
+    }
     m_integ->integrate(time);
     m_time = time;
     updateState(m_integ->solution());
+    if (m_recorder) {
+        m_recorder->record(m_time);
+    }
+}
+
+void ReactorNet::recordSteps(double time)
+{
+    if (!m_recorder->nRows()) {
+        m_recorder->record(m_time);
+    }
+    m_rec_y.resize(m_nv);
+    // The last step may end after the current time if the last output was
+    // interpolated.
+    double tint = m_integ->internalTime();
+    while (tint < time) {
+        if (tint > m_time) {
+            m_integ->getDenseOutput(tint, 0, DATA_PTR(m_rec_y));
+            updateState(DATA_PTR(m_rec_y));
+            m_recorder->record(tint);
+        }
+        tint = m_integ->step(time);
+    }
 }
 
 double ReactorNet::step(doublereal time)
@@ -135,11 +475,508 @@ double ReactorNet::step(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    if (m_recorder && !m_recorder->nRows()) {
+        m_recorder->record(m_time);
+    }
     m_time = m_integ->step(time);
     updateState(m_integ->solution());
+    if (m_recorder) {
+        m_recorder->record(m_time);
+    }
+    return m_time;
+}
+
+size_t ReactorNet::addEvent(size_t k, double value, int direction,
+                            int derivative)
+{
+    if (derivative != 0 && derivative != 1) {
+        throw CanteraError("ReactorNet::addEvent",
+                           "Events may only be defined on the value of a "
+                           "component or its first time derivative.");
+    }
+    Event e;
+    e.component = k;
+    e.value = value;
+    e.direction = direction;
+    e.derivative = derivative;
+    m_events.push_back(e);
+    m_event_g.clear();
+    return m_events.size() - 1;
+}
+
+double ReactorNet::advanceToEvent(double time)
+{
+    m_lastEvent = npos;
+    if (m_events.empty()) {
+        advance(time);
+        return m_time;
+    }
+    if (!m_init) {
+        if (m_maxstep < 0.0) {
+            m_maxstep = time - m_time;
+        }
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    for (size_t i = 0; i < m_events.size(); i++) {
+        if (m_events[i].component >= m_nv) {
+            throw IndexError("ReactorNet::advanceToEvent", "events",
+                             m_events[i].component, m_nv-1);
+        }
+    }
+
+    // Event functions at the current time, which are kept from the last call
+    // if it stopped at an event so that the same event is not found again.
+    if (m_event_g.size() != m_events.size() || m_event_t != m_time) {
+        vector_fp params(m_ntotpar, 1.0);
+        m_event_y.assign(m_integ->solution(), m_integ->solution() + m_nv);
+        m_event_ydot.resize(m_nv);
+        eval(m_time, DATA_PTR(m_event_y), DATA_PTR(m_event_ydot),
+             DATA_PTR(params));
+        evalEvents(DATA_PTR(m_event_y), DATA_PTR(m_event_ydot), m_event_g);
+        m_event_t = m_time;
+    }
+
+    if (m_recorder && !m_recorder->nRows()) {
+        m_recorder->record(m_time);
+    }
+
+    vector_fp g(m_events.size());
+    vector_fp groot(m_events.size());
+    vector_fp gevent;
+    double tevent = time;
+    while (m_time < time) {
+        // The integrator may already be ahead of the current time, e.g. if
+        // the last call stopped at an event, in which case the rest of the
+        // last step is checked first.
+        double tint = m_integ->internalTime();
+        if (tint <= m_time) {
+            tint = m_integ->step(time);
+        }
+        double tb = std::min(tint, time);
+        evalEvents(tb, g);
+        for (size_t i = 0; i < m_events.size(); i++) {
+            double ga = m_event_g[i];
+            int dir = m_events[i].direction;
+            if ((ga < 0 && g[i] >= 0 && dir >= 0) ||
+                (ga > 0 && g[i] <= 0 && dir <= 0)) {
+                groot = g;
+                double t = locateEvent(i, m_time, ga, tb, groot);
+                if (m_lastEvent == npos || t < tevent) {
+                    tevent = t;
+                    gevent = groot;
+                    m_lastEvent = i;
+                }
+            }
+        }
+        if (m_lastEvent != npos) {
+            m_time = tevent;
+            m_event_g = gevent;
+            m_event_t = m_time;
+            break;
+        }
+        m_time = tb;
+        m_event_g = g;
+        m_event_t = m_time;
+        if (m_recorder && m_time < time) {
+            // evalEvents() has interpolated the state at the end of the step
+            updateState(DATA_PTR(m_event_y));
+            m_recorder->record(m_time);
+        }
+    }
+
+    // Interpolate the solution within the last step
+    m_integ->integrate(m_time);
+    updateState(m_integ->solution());
+    if (m_recorder) {
+        m_recorder->record(m_time);
+    }
     return m_time;
 }
 
+void ReactorNet::evalEvents(double t, vector_fp& g)
+{
+    m_event_y.resize(m_nv);
+    m_event_ydot.resize(m_nv);
+    m_integ->getDenseOutput(t, 0, DATA_PTR(m_event_y));
+    m_integ->getDenseOutput(t, 1, DATA_PTR(m_event_ydot));
+    evalEvents(DATA_PTR(m_event_y), DATA_PTR(m_event_ydot), g);
+}
+
+void ReactorNet::evalEvents(const double* y, const double* ydot,
+                            vector_fp& g) const
+{
+    g.resize(m_events.size());
+    for (size_t i = 0; i < m_events.size(); i++) {
+        const Event& e = m_events[i];
+        double v = (e.derivative) ? ydot[e.component] : y[e.component];
+        g[i] = v - e.value;
+    }
+}
+
+double ReactorNet::locateEvent(size_t i, double ta, double ga, double tb,
+                               vector_fp& g)
+{
+    // Illinois variant of the method of false position. The bracket is
+    // [ta, tb], where tb is always on the far side of the crossing.
+    double sa = (ga > 0) ? 1.0 : -1.0;
+    double gb = g[i];
+    double ttol = 100 * std::numeric_limits<double>::epsilon() *
+                  (fabs(tb) + (tb - ta));
+    vector_fp gc(g.size());
+    int side = 0;
+    for (int iter = 0; iter < 100 && tb - ta > ttol; iter++) {
+        double tc = (ta * gb - tb * ga) / (gb - ga);
+        tc = std::max(ta + 0.5 * ttol, std::min(tb - 0.5 * ttol, tc));
+        evalEvents(tc, gc);
+        if (gc[i] * sa <= 0) {
+            tb = tc;
+            gb = gc[i];
+            g = gc;
+            if (side == -1) {
+                ga *= 0.5;
+            }
+            side = -1;
+        } else {
+            ta = tc;
+            ga = gc[i];
+            if (side == 1) {
+                gb *= 0.5;
+            }
+            side = 1;
+        }
+    }
+    return tb;
+}
+
+void ReactorNet::advanceAdjoint(double tf, const vector_fp& a,
+                                const vector_fp& b, vector_fp& dGdp)
+{
+    if (!m_init) {
+        if (m_maxstep < 0.0) {
+            m_maxstep = tf - m_time;
+        }
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    if (tf <= m_time) {
+        throw CanteraError("ReactorNet::advanceAdjoint",
+                           "Final time must be greater than the current time.");
+    }
+    if ((a.size() != m_nv && !a.empty()) ||
+        (b.size() != m_nv && !b.empty())) {
+        throw CanteraError("ReactorNet::advanceAdjoint",
+                           "Output weights must have length " +
+                           int2str(m_nv) + ".");
+    }
+
+    // The integrators used to recompute the forward solution from the
+    // checkpoints, and for the adjoint equations
+    if (!m_checkpointInteg) {
+        m_checkpointInteg = newIntegrator("CVODE");
+        m_adjointInteg = newIntegrator("CVODE");
+    }
+    m_checkpointInteg->setMethod(BDF_Method);
+    m_checkpointInteg->setProblemType(DENSE + NOJAC);
+    m_checkpointInteg->setIterator(Newton_Iter);
+    m_checkpointInteg->setTolerances(m_rtol, m_nv, &m_atol[0]);
+    m_checkpointInteg->setMaxStepSize(m_maxstep);
+    m_checkpointInteg->setMaxErrTestFails(m_maxErrTestFails);
+
+    // Integrate the forward problem, storing checkpoints
+    double t0 = m_time;
+    AdjointFunc adj(*this, m_ntotpar, t0, tf, a, b, m_adjointInterval,
+                    *m_checkpointInteg);
+    adj.addPoint(m_time, m_integ->solution());
+    while (m_time < tf) {
+        m_time = m_integ->step(tf);
+        if (m_time >= tf) {
+            // Interpolate back to the requested time
+            m_integ->integrate(tf);
+            m_time = tf;
+        }
+        adj.addPoint(m_time, m_integ->solution());
+    }
+    adj.finish();
+
+    dGdp.assign(m_ntotpar, 0.0);
+    // Scale of each solution component, including the changes in components
+    // such as radical mass fractions which are always small but change
+    // quickly.
+    vector_fp yscale(m_nv, 0.0);
+    for (size_t k = 0; k < m_nv; k++) {
+        yscale[k] = std::max(m_atol[k], m_atol[k] / m_rtol);
+        yscale[k] = std::max(yscale[k], adj.maxSolution()[k]);
+        yscale[k] = std::max(yscale[k], adj.maxDerivative()[k] * (tf - t0));
+    }
+    double gscale = adj.outputScale(yscale);
+    if (gscale == 0.0 || m_ntotpar == 0) {
+        updateState(m_integ->solution());
+        return;
+    }
+
+    // Integrate the adjoint equations backward in time, using tolerances
+    // that reflect the contribution of each component to the output
+    Integrator* integ = m_adjointInteg;
+    integ->setMethod(BDF_Method);
+    integ->setProblemType(DENSE + NOJAC);
+    integ->setIterator(Newton_Iter);
+    vector_fp atol(m_nv);
+    for (size_t k = 0; k < m_nv; k++) {
+        atol[k] = m_atolsens * gscale / yscale[k];
+    }
+    integ->setTolerances(m_rtolsens, m_nv, &atol[0]);
+    integ->setMaxErrTestFails(m_maxErrTestFails);
+    integ->initialize(0.0, adj);
+
+    // The adjoint solution and its time derivative at the start (lam0,
+    // dlam0) and end (lam1, dlam1) of each step of the forward solution
+    vector_fp lam0(m_nv), dlam0(m_nv), lam1(m_nv), dlam1(m_nv);
+    copy(integ->solution(), integ->solution() + m_nv, lam1.begin());
+    adj.eval(0.0, &lam1[0], &dlam1[0], 0);
+    scale(dlam1.begin(), dlam1.end(), dlam1.begin(), -1.0);
+
+    // Evaluate dG/dp = integral of lambda^T df/dp using two-point
+    // Gauss-Legendre quadrature on each step of the forward solution, as
+    // the adjoint solution reaches its start
+    const double gaussPoints[2] = {0.5 - sqrt(3.0)/6, 0.5 + sqrt(3.0)/6};
+    vector_fp g(m_ntotpar, 0.0);
+    vector_fp y(m_nv), ydot(m_nv), lam(m_nv);
+    Array2D dfdp(m_nv, m_ntotpar);
+    for (size_t n = adj.nIntervals(); n-- > 0;) {
+        adj.loadInterval(n);
+        size_t jstart = adj.pointIndex(adj.startTime(n));
+        for (size_t j = adj.pointIndex(adj.endTime(n)); j-- > jstart;) {
+            double tau = tf - adj.time(j);
+            integ->integrate(tau);
+            copy(integ->solution(), integ->solution() + m_nv, lam0.begin());
+            adj.eval(tau, &lam0[0], &dlam0[0], 0);
+            // convert to a derivative with respect to t
+            scale(dlam0.begin(), dlam0.end(), dlam0.begin(), -1.0);
+
+            double h = adj.time(j+1) - adj.time(j);
+            for (int q = 0; q < 2; q++) {
+                double t = adj.time(j) + gaussPoints[q] * h;
+                adj.interpolate(t, &y[0]);
+                hermite(lam0, dlam0, lam1, dlam1, h, gaussPoints[q], &lam[0]);
+                evalParamJacobian(t, &y[0], &ydot[0], &dfdp);
+                for (size_t i = 0; i < m_ntotpar; i++) {
+                    double sum = 0.0;
+                    for (size_t k = 0; k < m_nv; k++) {
+                        sum += lam[k] * dfdp(k,i);
+                    }
+                    g[i] += 0.5 * h * sum;
+                }
+            }
+            lam1.swap(lam0);
+            dlam1.swap(dlam0);
+        }
+    }
+    for (size_t p = 0; p < m_ntotpar; p++) {
+        dGdp[p] = g[m_sensIndex[p]];
+    }
+
+    // Leave the reactors in the state at tf
+    updateState(m_integ->solution());
+}
+
+void ReactorNet::solveSteady(int loglevel)
+{
+    if (!m_init) {
+        initialize();
+    }
+    m_ss_y.resize(m_nv);
+    m_ss_yold.resize(m_nv);
+    m_ss_y1.resize(m_nv);
+    m_ss_step.resize(m_nv);
+    m_ss_step1.resize(m_nv);
+    m_ss_params.assign(m_ntotpar, 1.0);
+    m_ss_jac.resize(m_nv, m_nv);
+    getInitialConditions(m_time, m_nv, DATA_PTR(m_ss_y));
+
+    doublereal dt = m_ss_dt;
+    const int maxAttempts = 100;
+    for (int attempt = 0; ; attempt++) {
+        writelog("Attempt Newton solution of steady-state problem...",
+                 loglevel);
+        m_ss_yold = m_ss_y;
+        int m = steadyNewton(0.0, loglevel-1);
+        if (m >= 0) {
+            writelog("    success.\n\n", loglevel);
+            break;
+        }
+        writelog("    failure.\n", loglevel);
+        if (attempt == maxAttempts) {
+            m_ss_y = m_ss_yold;
+            updateState(DATA_PTR(m_ss_y));
+            throw CanteraError("ReactorNet::solveSteady",
+                               "No steady-state solution found after " +
+                               int2str(maxAttempts) + " attempts.");
+        }
+        // Restore the last good solution and move it toward the steady
+        // state by pseudo-time stepping.
+        m_ss_y = m_ss_yold;
+        dt = steadyTimeStep(m_ss_nsteps, dt, loglevel);
+    }
+
+    // Leave the reactors in the steady state, and restart the integrator
+    // from there if integration is continued.
+    updateState(DATA_PTR(m_ss_y));
+    m_integrator_init = false;
+}
+
+doublereal ReactorNet::steadyTimeStep(int nsteps, doublereal dt, int loglevel)
+{
+    const doublereal dtmin = 1.0e-16;
+    const doublereal dtmax = 1.0e8;
+    char buf[100];
+    writelog("\n step    size (s)    iterations\n", loglevel);
+    writelog("==================================\n", loglevel);
+    int n = 0;
+    while (n < nsteps) {
+        m_ss_yold = m_ss_y;
+        int m = steadyNewton(1.0/dt, loglevel-1);
+        if (m >= 0) {
+            if (loglevel > 0) {
+                sprintf(buf, " %4d  %10.4g  %10d\n", n, dt, m);
+                writelog(buf);
+            }
+            n++;
+            // Increase the step size after an easy step
+            if (m <= 3) {
+                dt = std::min(1.5*dt, dtmax);
+            }
+        } else {
+            // No solution could be found with this time step. Decrease the
+            // step size and try again.
+            writelog("...failure.\n", loglevel);
+            m_ss_y = m_ss_yold;
+            dt *= 0.5;
+            if (dt < dtmin) {
+                updateState(DATA_PTR(m_ss_y));
+                throw CanteraError("ReactorNet::steadyTimeStep",
+                                   "Time integration failed.");
+            }
+        }
+    }
+    return dt;
+}
+
+int ReactorNet::steadyNewton(doublereal rdt, int loglevel)
+{
+    const int ndamp = 7;
+    doublereal* y = DATA_PTR(m_ss_y);
+    doublereal* y1 = DATA_PTR(m_ss_y1);
+    doublereal* step = DATA_PTR(m_ss_step);
+    doublereal* step1 = DATA_PTR(m_ss_step1);
+    doublereal* jac = m_ss_jac.ptrColumn(0);
+    integer* ipiv = DATA_PTR(m_ss_jac.ipiv());
+    char buf[100];
+    int info = 0;
+    writelog("\n  iter  step norm   damping     new step norm\n", loglevel);
+
+    for (int iter = 0; iter < m_ss_maxiter; iter++) {
+        // Jacobian of the time derivatives. The unperturbed time derivatives
+        // are returned in 'step'.
+        try {
+            evalJacobian(m_time, y, step, DATA_PTR(m_ss_params), &m_ss_jac);
+        } catch (CanteraError&) {
+            popError();
+            return -1;
+        }
+
+        // Form the Newton matrix, rdt*I - J, and the residual. In the
+        // steady problem, components with identically zero time derivatives
+        // would make the matrix singular, so they are held fixed instead.
+        for (size_t i = 0; i < m_nv; i++) {
+            bool frozen = (rdt == 0.0 && step[i] == 0.0);
+            for (size_t j = 0; frozen && j < m_nv; j++) {
+                frozen = (m_ss_jac(i,j) == 0.0);
+            }
+            for (size_t j = 0; j < m_nv; j++) {
+                m_ss_jac(i,j) = -m_ss_jac(i,j);
+            }
+            m_ss_jac(i,i) = (frozen) ? 1.0 : m_ss_jac(i,i) + rdt;
+            step[i] -= rdt * (y[i] - m_ss_yold[i]);
+        }
+
+        ct_dgetrf(m_nv, m_nv, jac, m_nv, ipiv, info);
+        if (info != 0) {
+            writelog("Newton matrix is singular.\n", loglevel);
+            return -1;
+        }
+        ct_dgetrs(ctlapack::NoTranspose, m_nv, 1, jac, m_nv, ipiv,
+                  step, m_nv, info);
+        doublereal s0 = steadyNorm(y, step);
+
+        // Find a damping coefficient such that the Newton step from the
+        // damped solution is smaller than the undamped step, as in
+        // MultiNewton::dampStep().
+        doublereal damp = 1.0;
+        doublereal s1 = 0.0;
+        int m;
+        for (m = 0; m < ndamp; m++) {
+            for (size_t i = 0; i < m_nv; i++) {
+                y1[i] = y[i] + damp * step[i];
+            }
+            if (steadyResidual(y1, rdt, step1)) {
+                ct_dgetrs(ctlapack::NoTranspose, m_nv, 1, jac, m_nv, ipiv,
+                          step1, m_nv, info);
+                s1 = steadyNorm(y1, step1);
+                if (s1 < 1.0 || s1 < s0) {
+                    break;
+                }
+            }
+            damp *= 0.5;
+        }
+        if (loglevel > 0) {
+            sprintf(buf, "  %4d  %10.3e  %10.3e  %10.3e\n",
+                    iter, s0, damp, s1);
+            writelog(buf);
+        }
+        if (m == ndamp) {
+            return -1;
+        }
+        m_ss_y.swap(m_ss_y1);
+        y = DATA_PTR(m_ss_y);
+        y1 = DATA_PTR(m_ss_y1);
+        if (s1 < 1.0) {
+            return iter + 1;
+        }
+    }
+    return -1;
+}
+
+bool ReactorNet::steadyResidual(doublereal* y, doublereal rdt, doublereal* r)
+{
+    try {
+        eval(m_time, y, r, DATA_PTR(m_ss_params));
+    } catch (CanteraError&) {
+        popError();
+        return false;
+    }
+    for (size_t i = 0; i < m_nv; i++) {
+        if (!(fabs(r[i]) < BigNumber)) {
+            return false;
+        }
+        r[i] -= rdt * (y[i] - m_ss_yold[i]);
+    }
+    return true;
+}
+
+doublereal ReactorNet::steadyNorm(const doublereal* y,
+                                  const doublereal* step) const
+{
+    doublereal sum = 0.0;
+    for (size_t i = 0; i < m_nv; i++) {
+        doublereal f = step[i] / (m_rtol * fabs(y[i]) + m_atol[i]);
+        sum += f*f;
+    }
+    return sqrt(sum / m_nv);
+}
+
 void ReactorNet::addReactor(Reactor* r, bool iown)
 {
     warn_deprecated("ReactorNet::addReactor(Reactor*)",
@@ -207,6 +1044,71 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::evalParamJacobian(double t, double* y, double* ydot,
+                                   Array2D* dfdp)
+{
+    Array2D& jac = *dfdp;
+    vector_fp p(m_ntotpar, 1.0);
+    eval(t, y, ydot, DATA_PTR(p));
+
+    // The derivatives with respect to reaction rate multipliers are computed
+    // by each reactor from the rates of progress. The derivatives with
+    // respect to the remaining parameters, which belong to walls, are found
+    // by finite differences. The time derivatives are linear in the rate
+    // multipliers, so a large perturbation can be used to limit the roundoff
+    // error.
+    const double dp = 1.0e-5;
+    size_t pstart = 0;
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        size_t pend = pstart + m_nparams[n];
+        for (size_t i = pstart; i < pend; i++) {
+            fill(jac.ptrColumn(i), jac.ptrColumn(i) + m_nv, 0.0);
+        }
+        size_t nrxn = 0;
+        if (pend > pstart) {
+            nrxn = m_reactors[n]->evalReactionParamDerivs(
+                       &jac(m_start[n], pstart), m_nv);
+        }
+        for (size_t i = pstart + nrxn; i < pend; i++) {
+            p[i] = 1.0 + dp;
+            eval(t, y, DATA_PTR(m_ydot), DATA_PTR(p));
+            for (size_t k = 0; k < m_nv; k++) {
+                jac(k,i) = (m_ydot[k] - ydot[k])/dp;
+            }
+            p[i] = 1.0;
+        }
+        pstart = pend;
+    }
+}
+
+void ReactorNet::evalSensitivities(double t, double* y, double* ydot,
+                                   double** s, double** sdot)
+{
+    m_sens_jac.resize(m_nv, m_nv);
+    m_sens_dfdp.resize(m_nv, m_ntotpar);
+    m_sens_ydot.resize(m_nv);
+
+    // The integrator may evaluate the sensitivity equations several times
+    // at the same state, in which case the Jacobian can be reused.
+    if (t != m_sens_t || m_sens_y.size() != m_nv ||
+            !std::equal(y, y + m_nv, m_sens_y.begin())) {
+        vector_fp p(m_ntotpar, 1.0);
+        m_sens_y.assign(y, y + m_nv);
+        evalJacobian(t, DATA_PTR(m_sens_y), DATA_PTR(m_sens_ydot),
+                     DATA_PTR(p), &m_sens_jac);
+        evalParamJacobian(t, DATA_PTR(m_sens_y), DATA_PTR(m_sens_ydot),
+                          &m_sens_dfdp);
+        m_sens_t = t;
+    }
+
+    for (size_t i = 0; i < m_ntotpar; i++) {
+        copy(m_sens_dfdp.ptrColumn(i), m_sens_dfdp.ptrColumn(i) + m_nv,
+             sdot[i]);
+        ct_dgemv(ctlapack::ColMajor, ctlapack::NoTranspose, m_nv, m_nv, 1.0,
+                 m_sens_jac.ptrColumn(0), m_nv, s[i], 1, 1.0, sdot[i], 1);
+    }
+}
+
 void ReactorNet::updateState(doublereal* y)
 {
     for (size_t n = 0; n < m_reactors.size(); n++) {
@@ -228,7 +1130,14 @@ size_t ReactorNet::globalComponentIndex(const string& component, size_t reactor)
     if (!m_init) {
         initialize();
     }
-    return m_start[reactor] + m_reactors[reactor]->componentIndex(component);
+    std::map<std::string, size_t>& cache = m_componentIndex[reactor];
+    std::map<std::string, size_t>::const_iterator iter = cache.find(component);
+    if (iter != cache.end()) {
+        return iter->second;
+    }
+    size_t k = m_start[reactor] + m_reactors[reactor]->componentIndex(component);
+    cache[component] = k;
+    return k;
 }
 
 void ReactorNet::registerSensitivityReaction(void* reactor,
@@ -0,0 +1,215 @@
+//! @file ReactorRecorder.cpp
+#include "cantera/zeroD/ReactorRecorder.h"
+#include "cantera/zeroD/Reactor.h"
+#include "cantera/kinetics/Kinetics.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorRecorder::ReactorRecorder() :
+    m_nrows(0),
+    m_capacity(0),
+    m_nexports(0)
+{
+    m_names.push_back("time");
+}
+
+ReactorRecorder::~ReactorRecorder()
+{
+}
+
+size_t ReactorRecorder::add(Reactor& r, const std::string& quantity)
+{
+    if (m_nrows) {
+        throw CanteraError("ReactorRecorder::add", "Quantities cannot be "
+                           "added after rows have been recorded.");
+    }
+    Entry e;
+    e.reactor = &r;
+    e.start = m_names.size();
+    string prefix = r.name() + ".";
+    thermo_t& thermo = r.contents();
+    size_t nsp = thermo.nSpecies();
+    if (quantity == "T") {
+        e.quantity = Temperature;
+        m_names.push_back(prefix + quantity);
+    } else if (quantity == "P") {
+        e.quantity = Pressure;
+        m_names.push_back(prefix + quantity);
+    } else if (quantity == "density") {
+        e.quantity = Density;
+        m_names.push_back(prefix + quantity);
+    } else if (quantity == "volume") {
+        e.quantity = Volume;
+        m_names.push_back(prefix + quantity);
+    } else if (quantity == "mass") {
+        e.quantity = Mass;
+        m_names.push_back(prefix + quantity);
+    } else if (quantity == "Y" || quantity == "X") {
+        e.quantity = (quantity == "Y") ? MassFractions : MoleFractions;
+        for (size_t k = 0; k < nsp; k++) {
+            m_names.push_back(prefix + quantity + "_" + thermo.speciesName(k));
+        }
+    } else if (quantity == "net_production_rates") {
+        r.kinetics();
+        e.quantity = NetProductionRates;
+        for (size_t k = 0; k < nsp; k++) {
+            m_names.push_back(prefix + "wdot_" + thermo.speciesName(k));
+        }
+    } else if (quantity == "heat_release_rate") {
+        r.kinetics();
+        e.quantity = HeatReleaseRate;
+        m_names.push_back(prefix + quantity);
+    } else {
+        throw CanteraError("ReactorRecorder::add",
+                           "Unknown quantity '" + quantity + "'");
+    }
+    m_entries.push_back(e);
+    m_work.resize(std::max(m_work.size(), nsp));
+    m_work2.resize(std::max(m_work2.size(), nsp));
+    m_row.resize(m_names.size());
+
+    // The existing buffer has too few columns
+    if (m_nexports) {
+        m_retired.push_back(vector_fp());
+        m_retired.back().swap(m_data);
+    }
+    m_data.clear();
+    m_capacity = 0;
+    return e.start;
+}
+
+size_t ReactorRecorder::columnIndex(const std::string& name) const
+{
+    for (size_t j = 0; j < m_names.size(); j++) {
+        if (m_names[j] == name) {
+            return j;
+        }
+    }
+    return npos;
+}
+
+void ReactorRecorder::reserve(size_t nrows)
+{
+    if (nrows <= m_capacity) {
+        return;
+    }
+    size_t ncols = m_names.size();
+    vector_fp data(nrows * ncols);
+    for (size_t j = 0; j < ncols; j++) {
+        std::copy(m_data.begin() + j * m_capacity,
+                  m_data.begin() + j * m_capacity + m_nrows,
+                  data.begin() + j * nrows);
+    }
+    if (m_nexports) {
+        m_retired.push_back(vector_fp());
+        m_retired.back().swap(m_data);
+    }
+    m_data.swap(data);
+    m_capacity = nrows;
+}
+
+void ReactorRecorder::releaseExport()
+{
+    if (--m_nexports == 0) {
+        m_retired.clear();
+    }
+}
+
+void ReactorRecorder::streamTo(const std::string& filename)
+{
+    if (m_stream.is_open()) {
+        m_stream.close();
+    }
+    if (filename != "") {
+        m_stream.open(filename.c_str(), ios::out | ios::binary);
+        if (!m_stream) {
+            throw CanteraError("ReactorRecorder::streamTo",
+                               "Could not open file '" + filename + "'");
+        }
+    }
+}
+
+void ReactorRecorder::record(double t)
+{
+    if (m_nrows == m_capacity) {
+        reserve(std::max<size_t>(2 * m_capacity, 64));
+    }
+    double* row = &m_data[m_nrows];
+    size_t ld = m_capacity;
+    row[0] = t;
+    Reactor* current = 0;
+    for (size_t n = 0; n < m_entries.size(); n++) {
+        const Entry& e = m_entries[n];
+        Reactor& r = *e.reactor;
+        if (e.reactor != current) {
+            // Reactors may share a ThermoPhase object
+            r.restoreState();
+            current = e.reactor;
+        }
+        double* v = row + e.start * ld;
+        thermo_t& thermo = r.contents();
+        size_t nsp = thermo.nSpecies();
+        switch (e.quantity) {
+        case Temperature:
+            v[0] = r.temperature();
+            break;
+        case Pressure:
+            v[0] = r.pressure();
+            break;
+        case Density:
+            v[0] = r.density();
+            break;
+        case Volume:
+            v[0] = r.volume();
+            break;
+        case Mass:
+            v[0] = r.mass();
+            break;
+        case MassFractions:
+            for (size_t k = 0; k < nsp; k++) {
+                v[k*ld] = r.massFraction(k);
+            }
+            break;
+        case MoleFractions:
+            thermo.getMoleFractions(&m_work[0]);
+            for (size_t k = 0; k < nsp; k++) {
+                v[k*ld] = m_work[k];
+            }
+            break;
+        case NetProductionRates:
+            if (r.chemistryEnabled()) {
+                r.kinetics().getNetProductionRates(&m_work[0]);
+            } else {
+                std::fill(m_work.begin(), m_work.begin() + nsp, 0.0);
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                v[k*ld] = m_work[k];
+            }
+            break;
+        case HeatReleaseRate:
+            v[0] = 0.0;
+            if (r.chemistryEnabled()) {
+                r.kinetics().getNetProductionRates(&m_work[0]);
+                thermo.getPartialMolarEnthalpies(&m_work2[0]);
+                for (size_t k = 0; k < nsp; k++) {
+                    v[0] -= m_work[k] * m_work2[k];
+                }
+            }
+            break;
+        }
+    }
+
+    if (m_stream.is_open()) {
+        for (size_t j = 0; j < m_row.size(); j++) {
+            m_row[j] = row[j*ld];
+        }
+        m_stream.write(reinterpret_cast<const char*>(&m_row[0]),
+                       m_row.size() * sizeof(double));
+    }
+    m_nrows++;
+}
+
+}
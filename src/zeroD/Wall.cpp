@@ -72,7 +72,7 @@ doublereal Wall::vdot(doublereal t)
     double rate1 = m_k * m_area *
                    (m_left->pressure() - m_right->pressure());
     if (m_vf) {
-        rate1 += m_area * m_vf->eval(t);
+        rate1 += m_area * m_vfCode.eval(t);
     }
     return rate1;
 }
@@ -87,7 +87,7 @@ doublereal Wall::Q(doublereal t)
         q1 += m_emiss * m_area * StefanBoltz * (tl*tl*tl*tl - tr*tr*tr*tr);
     }
     if (m_qf) {
-        q1 += m_area * m_qf->eval(t);
+        q1 += m_area * m_qfCode.eval(t);
     }
     return q1;
 }
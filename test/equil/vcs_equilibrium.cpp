@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/equil/vcs_MultiPhaseEquil.h"
+#include "cantera/base/global.h"
+
+namespace Cantera
+{
+
+class VcsEquilibriumTest : public testing::Test
+{
+public:
+    VcsEquilibriumTest() : gas("gri30.xml", "gri30_mix") {}
+
+    //! Check the temperature and some of the mole fractions against values
+    //! computed with the nested temperature iteration used before the secant
+    //! updates were introduced
+    void check(double T, const double* X) {
+        EXPECT_NEAR(T, gas.temperature(), 1e-8 * T);
+        for (size_t k = 0; k < 7; k++) {
+            EXPECT_NEAR(X[k], gas.moleFraction(species[k]), 1e-6 * X[k])
+                << species[k];
+        }
+    }
+
+    IdealGasPhase gas;
+    static const char* species[7];
+};
+
+const char* VcsEquilibriumTest::species[7] =
+    {"CO2", "H2O", "CO", "OH", "H2", "O2", "NO"};
+
+TEST_F(VcsEquilibriumTest, HP)
+{
+    gas.setState_TPX(300, OneAtm, "CH4:1, O2:2, N2:7.52");
+    gas.equilibrate("HP", "vcs");
+    double X[] = {0.08536421734, 0.1834665935, 0.008987939087, 0.002875407488,
+                  0.0036045255, 0.004622237215, 0.001888205763};
+    check(2225.524583, X);
+    EXPECT_DOUBLE_EQ(OneAtm, gas.pressure());
+}
+
+TEST_F(VcsEquilibriumTest, UP)
+{
+    gas.setState_TPX(300, OneAtm, "CH4:1, O2:2, N2:7.52");
+    gas.equilibrate("UP", "vcs");
+    double X[] = {0.07026246977, 0.1716443968, 0.022841219, 0.008728862268,
+                  0.009066087766, 0.01116981398, 0.004894008828};
+    check(2487.023557, X);
+}
+
+TEST_F(VcsEquilibriumTest, SP)
+{
+    gas.setState_TPX(1500, OneAtm, "CH4:1, O2:2, N2:7.52");
+    gas.equilibrate("SP", "vcs");
+    double X[] = {0.09497227125, 0.190033596, 7.788162255e-05, 1.547546037e-05,
+                  5.889122386e-05, 5.443372314e-05, 2.020577258e-05};
+    check(1514.295548, X);
+}
+
+TEST_F(VcsEquilibriumTest, reuse_solver)
+{
+    // A second phase and mixture, equilibrated from scratch every time
+    IdealGasPhase gas2("gri30.xml", "gri30_mix");
+    MultiPhase warmMix, coldMix;
+    warmMix.addPhase(&gas, 1.0);
+    warmMix.init();
+    coldMix.addPhase(&gas2, 1.0);
+    coldMix.init();
+    VCSnonideal::vcs_MultiPhaseEquil warm(&warmMix, 0);
+    warm.setReuseSolver(true);
+
+    size_t kk = gas.nSpecies();
+    vector_fp n0(kk, 0.0);
+    n0[gas.speciesIndex("CH4")] = 1.0;
+    n0[gas.speciesIndex("O2")] = 2.0;
+    n0[gas.speciesIndex("N2")] = 7.52;
+
+    warmMix.setState_TPMoles(1500.0, OneAtm, &n0[0]);
+    for (int i = 0; i < 5; i++) {
+        // Start each warm-started problem from the previous equilibrium
+        // composition, for which the previous component basis is still
+        // optimal
+        double T = 1500.0 + 25.0 * i;
+        warmMix.setTemperature(T);
+        ASSERT_EQ(0, warm.equilibrate_TP());
+        EXPECT_EQ(i, warm.numWarmStarts());
+
+        coldMix.setState_TPMoles(T, OneAtm, &n0[0]);
+        VCSnonideal::vcs_MultiPhaseEquil cold(&coldMix, 0);
+        ASSERT_EQ(0, cold.equilibrate_TP());
+        EXPECT_EQ(0, cold.numWarmStarts());
+
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(gas2.moleFraction(k), gas.moleFraction(k),
+                        1e-6 * gas2.moleFraction(k) + 1e-14)
+                << "T = " << T << ", " << gas.speciesName(k);
+        }
+    }
+    EXPECT_EQ(0, warm.numWarmStartFailures());
+    EXPECT_GT(warm.numBasisReuses(), 0);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from vcs_equilibrium.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
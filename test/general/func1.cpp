@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "cantera/numerics/Func1.h"
+
+namespace Cantera
+{
+
+class CompiledFunc1Test : public testing::Test
+{
+public:
+    //! Check that the compiled function gives exactly the same values as the
+    //! original function
+    void checkCompiled(const Func1& f) {
+        CompiledFunc1 code(f);
+        for (int i = -20; i <= 20; i++) {
+            double t = 0.37 * i + 0.01;
+            double expected = f.eval(t);
+            if (expected != expected) {
+                EXPECT_NE(code.eval(t), code.eval(t)) << "t = " << t;
+            } else {
+                EXPECT_EQ(expected, code.eval(t)) << "t = " << t;
+            }
+        }
+    }
+};
+
+TEST_F(CompiledFunc1Test, elementary)
+{
+    checkCompiled(Sin1(2.5));
+    checkCompiled(Cos1(0.3));
+    checkCompiled(Exp1(-1.1));
+    checkCompiled(Pow1(2.0));
+    checkCompiled(Pow1(0.5));
+    checkCompiled(Const1(4.2));
+    double c[3] = {1.0, -2.0, 0.5};
+    checkCompiled(Poly1(2, c));
+    checkCompiled(Gaussian(2.0, 0.5, 1.5));
+}
+
+TEST_F(CompiledFunc1Test, arithmetic)
+{
+    Sum1 sum(*new Sin1(2.0), *new Exp1(0.1));
+    checkCompiled(sum);
+    Diff1 diff(*new Cos1(1.5), *new Pow1(3.0));
+    checkCompiled(diff);
+    Product1 prod(*new Sin1(0.7), *new Cos1(1.3));
+    checkCompiled(prod);
+    Ratio1 ratio(*new Exp1(0.2), *new PlusConstant1(*new Pow1(2.0), 1.0));
+    checkCompiled(ratio);
+    TimesConstant1 tc(*new Sin1(3.0), -2.5);
+    checkCompiled(tc);
+}
+
+TEST_F(CompiledFunc1Test, nested)
+{
+    // exp(sin(2t) * (t^2 + 1)) / (3 cos(t) - t) + 0.5, evaluated periodically
+    Func1& inner = newProdFunction(*new Sin1(2.0),
+                                   newPlusConstFunction(*new Pow1(2.0), 1.0));
+    Func1& num = newCompositeFunction(*new Exp1(1.0), inner);
+    Func1& den = newDiffFunction(newTimesConstFunction(*new Cos1(1.0), 3.0),
+                                 *new Pow1(1.0));
+    Func1& f = newPlusConstFunction(newRatioFunction(num, den), 0.5);
+    checkCompiled(f);
+    Periodic1 periodic(f, 1.7);
+    checkCompiled(periodic);
+    EXPECT_GT(CompiledFunc1(f).size(), (size_t) 10);
+}
+
+TEST_F(CompiledFunc1Test, generic)
+{
+    class Square : public Func1
+    {
+    public:
+        virtual doublereal eval(doublereal t) const {
+            return t * t;
+        }
+    };
+    Sum1 f(*new Square(), *new Sin1(1.0));
+    checkCompiled(f);
+}
+
+TEST_F(CompiledFunc1Test, set_constant)
+{
+    // Constants changed after compiling are used by the compiled function
+    Sin1* s = new Sin1(2.0);
+    Func1& g = newPlusConstFunction(*s, 1.0);
+    Periodic1 f(g, 1.7);
+    CompiledFunc1 code(f);
+    s->setC(3.0);
+    g.setC(-0.5);
+    f.setC(2.1);
+    checkCompiled(f);
+    EXPECT_EQ(f.eval(0.9), code.eval(0.9));
+}
+
+TEST_F(CompiledFunc1Test, deep_tree)
+{
+    // Each level of nesting of a binary operation uses one more stack entry
+    Func1* f = new Sin1(1.0);
+    for (size_t i = 1; i < CompiledFunc1::MaxDepth; i++) {
+        f = new Sum1(*new Cos1(0.1 * i), *f);
+    }
+    EXPECT_GT(CompiledFunc1(*f).size(), CompiledFunc1::MaxDepth);
+    checkCompiled(*f);
+
+    // A tree which needs a deeper stack than is available is evaluated with
+    // Func1::eval
+    f = new Sum1(*f, *new Cos1(2.0));
+    EXPECT_EQ((size_t) 1, CompiledFunc1(*f).size());
+    checkCompiled(*f);
+    delete f;
+}
+
+}
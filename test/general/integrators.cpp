@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+#include "cantera/numerics/RosenbrockIntegrator.h"
+#include "cantera/numerics/RungeKuttaIntegrator.h"
+
+namespace Cantera
+{
+
+//! y0' = -y0, y1' = -k (y1 - sin t) + cos t, with the exact solution
+//! y0 = exp(-t), y1 = sin(t). The problem is stiff for large *k*.
+class LinearProblem : public FuncEval
+{
+public:
+    explicit LinearProblem(double k_) : k(k_) {}
+    virtual void eval(double t, double* y, double* ydot, double* p) {
+        ydot[0] = -y[0];
+        ydot[1] = -k * (y[1] - sin(t)) + cos(t);
+    }
+    virtual void getInitialConditions(double t0, size_t leny, double* y) {
+        y[0] = exp(-t0);
+        y[1] = sin(t0);
+    }
+    virtual size_t neq() {
+        return 2;
+    }
+    virtual bool hasJacobian() {
+        return true;
+    }
+    virtual void evalJacobian(double t, double* y, double* ydot, double* jac) {
+        jac[0] = -1.0;
+        jac[1] = 0.0;
+        jac[2] = 0.0;
+        jac[3] = -k;
+    }
+    double k;
+};
+
+class OneStepIntegratorTest : public testing::Test
+{
+public:
+    void checkSolution(Integrator& integ, double t, double tol) {
+        EXPECT_NEAR(exp(-t), integ.solution(0), tol);
+        EXPECT_NEAR(sin(t), integ.solution(1), tol);
+    }
+};
+
+TEST_F(OneStepIntegratorTest, rosenbrock_stiff)
+{
+    LinearProblem f(1e4);
+    RosenbrockIntegrator fd, analytic;
+    analytic.setProblemType(DENSE + JAC);
+    RosenbrockIntegrator* integs[2] = {&fd, &analytic};
+    for (size_t i = 0; i < 2; i++) {
+        integs[i]->setTolerances(1e-8, 1e-12);
+        integs[i]->initialize(0.0, f);
+        integs[i]->integrate(0.5);
+        checkSolution(*integs[i], 0.5, 1e-6);
+        integs[i]->integrate(2.0);
+        checkSolution(*integs[i], 2.0, 1e-6);
+        EXPECT_EQ(2.0, integs[i]->internalTime());
+    }
+    EXPECT_EQ(fd.nJacobians(), analytic.nJacobians());
+    EXPECT_LT(analytic.nEvals(), fd.nEvals());
+}
+
+TEST_F(OneStepIntegratorTest, rosenbrock_reinitialize)
+{
+    LinearProblem f(1e4);
+    RosenbrockIntegrator integ;
+    integ.initialize(0.0, f);
+    integ.integrate(1.0);
+    int nevals = integ.nEvals();
+    integ.reinitialize(0.0, f);
+    integ.integrate(1.0);
+    EXPECT_EQ(nevals, integ.nEvals());
+    checkSolution(integ, 1.0, 1e-6);
+}
+
+TEST_F(OneStepIntegratorTest, analytic_jacobian_required)
+{
+    class NoJacobian : public LinearProblem {
+    public:
+        NoJacobian() : LinearProblem(1.0) {}
+        virtual bool hasJacobian() {
+            return false;
+        }
+    } f;
+    RosenbrockIntegrator integ;
+    integ.setProblemType(DENSE + JAC);
+    EXPECT_THROW(integ.initialize(0.0, f), CanteraError);
+}
+
+TEST_F(OneStepIntegratorTest, runge_kutta_nonstiff)
+{
+    LinearProblem f(2.0);
+    RungeKuttaIntegrator integ;
+    integ.setTolerances(1e-8, 1e-12);
+    integ.initialize(0.0, f);
+    integ.integrate(3.0);
+    checkSolution(integ, 3.0, 1e-6);
+}
+
+TEST_F(OneStepIntegratorTest, runge_kutta_stiff)
+{
+    LinearProblem f(1e5);
+    RungeKuttaIntegrator integ;
+    integ.initialize(0.0, f);
+    EXPECT_THROW(integ.integrate(1.0), CanteraError);
+}
+
+TEST_F(OneStepIntegratorTest, dense_output)
+{
+    LinearProblem f(2.0);
+    RungeKuttaIntegrator integ;
+    integ.setTolerances(1e-10, 1e-14);
+    integ.initialize(0.0, f);
+    double y[2], ydot[2];
+    while (integ.internalTime() < 1.0) {
+        double t0 = integ.internalTime();
+        double t1 = integ.step(1.0);
+        EXPECT_LE(t1, 1.0);
+        double t = 0.5 * (t0 + t1);
+        integ.getDenseOutput(t, 0, y);
+        integ.getDenseOutput(t, 1, ydot);
+        EXPECT_NEAR(exp(-t), y[0], 1e-6);
+        EXPECT_NEAR(sin(t), y[1], 1e-6);
+        EXPECT_NEAR(-exp(-t), ydot[0], 1e-4);
+        EXPECT_NEAR(cos(t), ydot[1], 1e-4);
+    }
+    EXPECT_THROW(integ.getDenseOutput(2.0, 0, y), CanteraError);
+}
+
+}
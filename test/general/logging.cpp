@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include "cantera/base/global.h"
+#include "cantera/base/logger.h"
+
+namespace Cantera
+{
+
+class StringLogger : public Logger
+{
+public:
+    explicit StringLogger(std::string& out) : m_out(out) {}
+    virtual void write(const std::string& msg) {
+        m_out += msg;
+    }
+    virtual void writeendl() {
+        m_out += "\n";
+    }
+    std::string& m_out;
+};
+
+class LoggingTest : public testing::Test
+{
+public:
+    LoggingTest() {
+        setLogger(new StringLogger(output));
+    }
+    ~LoggingTest() {
+        setLogger(new Logger());
+    }
+    std::string output;
+};
+
+TEST_F(LoggingTest, flushlog)
+{
+    writelog("foo ");
+    writelog("bar\nbaz");
+    writelogendl();
+    writelog("qux");
+    flushlog();
+    EXPECT_EQ("foo bar\nbaz\nqux", output);
+    flushlog();
+    EXPECT_EQ("foo bar\nbaz\nqux", output);
+}
+
+TEST_F(LoggingTest, error_stack)
+{
+    int n0 = nErrors();
+    setError("proc1", "first error");
+    setError("proc2", "second error");
+    EXPECT_EQ(n0 + 2, nErrors());
+    EXPECT_NE(std::string::npos, lastErrorMessage().find("second error"));
+    popError();
+    EXPECT_NE(std::string::npos, lastErrorMessage().find("first error"));
+    showErrors();
+    EXPECT_EQ(0, nErrors());
+    EXPECT_NE(std::string::npos, output.find("proc1"));
+}
+
+}
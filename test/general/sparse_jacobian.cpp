@@ -0,0 +1,269 @@
+#include "gtest/gtest.h"
+#include "cantera/numerics/SparseJacobian.h"
+#include "cantera/numerics/ResidJacEval.h"
+#if HAS_SUNDIALS
+#include "cantera/numerics/IDA_Solver.h"
+#endif
+
+#include <cmath>
+
+namespace Cantera
+{
+
+//! Reaction and diffusion on a line with fixed boundary values:
+//! \f$ \dot{y}_i = D (y_{i-1} - 2 y_i + y_{i+1}) - k y_i^2 \f$
+class DiffusionReaction : public ResidJacEval
+{
+public:
+    DiffusionReaction(int n) : D(50.0), k(2.0) {
+        neq_ = n;
+    }
+
+    virtual int evalResidNJ(const doublereal t, const doublereal delta_t,
+                            const doublereal* const y,
+                            const doublereal* const ydot,
+                            doublereal* const resid,
+                            const ResidEval_Type_Enum evalType,
+                            const int id_x, const doublereal delta_x) {
+        for (int i = 0; i < neq_; i++) {
+            double left = (i > 0) ? y[i-1] : 1.0;
+            double right = (i + 1 < neq_) ? y[i+1] : 0.0;
+            resid[i] = ydot[i] - D * (left - 2 * y[i] + right) + k * y[i] * y[i];
+        }
+        return 1;
+    }
+
+    virtual int getInitialConditions(const doublereal t0, doublereal* const y,
+                                     doublereal* const ydot) {
+        for (int i = 0; i < neq_; i++) {
+            y[i] = 0.5 + 0.4 * std::sin(0.7 * i);
+            ydot[i] = 0.0;
+        }
+        // Consistent derivatives are the negative of the residual with
+        // ydot = 0
+        vector_fp r(neq_);
+        evalResidNJ(t0, 0.0, y, ydot, &r[0], Base_ResidEval, -1, 0.0);
+        for (int i = 0; i < neq_; i++) {
+            ydot[i] = -r[i];
+        }
+        return 1;
+    }
+
+    double D;
+    double k;
+};
+
+
+class SparseJacobianTest : public testing::Test
+{
+public:
+    //! Nonzero pattern of a tridiagonal matrix with *n* rows. The diagonal
+    //! elements are omitted, since they are added by SparseJacobian.
+    void tridiagonal(size_t n, vector_int& rowStart, vector_int& cols) {
+        rowStart.clear();
+        cols.clear();
+        for (size_t i = 0; i < n; i++) {
+            rowStart.push_back((int) cols.size());
+            if (i + 1 < n) {
+                cols.push_back((int) i + 1);
+            }
+            if (i > 0) {
+                cols.push_back((int) i - 1);
+            }
+        }
+        rowStart.push_back((int) cols.size());
+    }
+};
+
+TEST_F(SparseJacobianTest, finite_difference)
+{
+    size_t n = 11;
+    vector_int rowStart, cols;
+    tridiagonal(n, rowStart, cols);
+    SparseJacobian J(n, rowStart, cols);
+    DiffusionReaction f((int) n);
+    vector_fp y(n), ydot(n), r(n), dy(n);
+    f.getInitialConditions(0.0, &y[0], &ydot[0]);
+    f.evalResidNJ(0.0, 0.0, &y[0], &ydot[0], &r[0], Base_ResidEval, -1, 0.0);
+    for (size_t j = 0; j < n; j++) {
+        dy[j] = 1e-7 * (1.0 + y[j]);
+    }
+    double cj = 1e3;
+    ASSERT_EQ(0, J.evalFiniteDifference(f, 0.0, 0.0, cj, &y[0], &ydot[0],
+                                        &r[0], &dy[0]));
+
+    // Dense finite difference Jacobian, with one residual evaluation for
+    // each column
+    vector_fp y1(y), ydot1(ydot), r1(n);
+    for (size_t j = 0; j < n; j++) {
+        y1[j] += dy[j];
+        ydot1[j] += cj * dy[j];
+        f.evalResidNJ(0.0, 0.0, &y1[0], &ydot1[0], &r1[0], Base_ResidEval,
+                      -1, 0.0);
+        y1[j] = y[j];
+        ydot1[j] = ydot[j];
+        for (size_t i = 0; i < n; i++) {
+            double dense = (r1[i] - r[i]) / dy[j];
+            if (J.index(i, j) < 0) {
+                EXPECT_EQ(0.0, dense);
+            } else {
+                EXPECT_DOUBLE_EQ(dense, J(i, j)) << i << ", " << j;
+            }
+        }
+        // Compare with the exact value
+        double exact = cj + 2 * f.D + 2 * f.k * y[j];
+        EXPECT_NEAR(exact, J(j, j), 1e-6 * exact);
+    }
+}
+
+TEST_F(SparseJacobianTest, pattern)
+{
+    vector_int rowStart, cols;
+    tridiagonal(5, rowStart, cols);
+    SparseJacobian J(5, rowStart, cols);
+    EXPECT_TRUE(J.isSparse());
+    ASSERT_EQ((size_t) 13, J.nNonzeros());
+    EXPECT_EQ(2, J.rowStart()[1]);
+    EXPECT_EQ(0, J.colIndex()[2]);
+    EXPECT_EQ(1, J.colIndex()[3]);
+    EXPECT_EQ(2, J.colIndex()[4]);
+    EXPECT_EQ(-1, J.index(0, 2));
+
+    J(2, 1) = 3.0;
+    const SparseJacobian& Jc = J;
+    EXPECT_EQ(3.0, Jc(2, 1));
+    EXPECT_EQ(0.0, Jc(4, 0));
+    EXPECT_THROW(J(4, 0), CanteraError);
+
+    vector_int badCols(1, 5);
+    vector_int badStart(6, 0);
+    badStart[1] = badStart[2] = badStart[3] = badStart[4] = badStart[5] = 1;
+    EXPECT_THROW(SparseJacobian(5, badStart, badCols), CanteraError);
+}
+
+TEST_F(SparseJacobianTest, coloring)
+{
+    size_t n = 10;
+    vector_int rowStart, cols;
+    tridiagonal(n, rowStart, cols);
+    SparseJacobian J(n, rowStart, cols);
+    EXPECT_EQ((size_t) 3, J.nColors());
+
+    // Columns with the same color have no rows in common
+    for (size_t i = 0; i < n; i++) {
+        for (int k = J.rowStart()[i]; k < J.rowStart()[i+1]; k++) {
+            for (int kk = k + 1; kk < J.rowStart()[i+1]; kk++) {
+                EXPECT_NE(J.color(J.colIndex()[k]), J.color(J.colIndex()[kk]));
+            }
+        }
+    }
+    ASSERT_EQ((size_t) 3, J.colRows(4).size());
+    EXPECT_EQ(3, J.colRows(4)[0]);
+    EXPECT_EQ(J.index(5, 4), J.colElements(4)[2]);
+}
+
+TEST_F(SparseJacobianTest, ilu_exact_for_tridiagonal)
+{
+    // ILU(0) produces no fill-in for a tridiagonal matrix, so the solution
+    // is exact.
+    size_t n = 8;
+    vector_int rowStart, cols;
+    tridiagonal(n, rowStart, cols);
+    SparseJacobian J(n, rowStart, cols);
+    for (size_t i = 0; i < n; i++) {
+        J(i, i) = 4.0 + i;
+        if (i > 0) {
+            J(i, i-1) = -1.0 - 0.1 * i;
+        }
+        if (i + 1 < n) {
+            J(i, i+1) = -2.0;
+        }
+    }
+    vector_fp x(n), b(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = 1.0 + 0.5 * i;
+    }
+    J.mult(&x[0], &b[0]);
+    EXPECT_DOUBLE_EQ(4.0 * 1.0 - 2.0 * 1.5, b[0]);
+    ASSERT_EQ(0, J.factorILU());
+    J.solveILU(&b[0]);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(x[i], b[i], 1e-13);
+    }
+}
+
+TEST_F(SparseJacobianTest, ilu_approximate)
+{
+    // Arrow-shaped matrix: the first row and column are full, which produces
+    // fill-in that is dropped by ILU(0), so the solution is approximate.
+    size_t n = 6;
+    vector_int rowStart, cols;
+    for (size_t i = 0; i < n; i++) {
+        rowStart.push_back((int) cols.size());
+        if (i == 0) {
+            for (size_t j = 1; j < n; j++) {
+                cols.push_back((int) j);
+            }
+        } else {
+            cols.push_back(0);
+        }
+    }
+    rowStart.push_back((int) cols.size());
+    SparseJacobian J(n, rowStart, cols);
+    EXPECT_EQ(n, J.nColors());
+    for (size_t i = 0; i < n; i++) {
+        J(i, i) = 10.0;
+        if (i > 0) {
+            J(0, i) = 1.0;
+            J(i, 0) = 1.0;
+        }
+    }
+    vector_fp x(n, 1.0), b(n);
+    J.mult(&x[0], &b[0]);
+    ASSERT_EQ(0, J.factorILU());
+    J.solveILU(&b[0]);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(x[i], b[i], 0.1);
+    }
+
+    // A zero pivot is reported
+    J.zero();
+    EXPECT_EQ(1, J.factorILU());
+}
+
+#if HAS_SUNDIALS
+TEST_F(SparseJacobianTest, ida_sparse_linear_solver)
+{
+    // Solution using the preconditioned iterative linear solver should
+    // match the one obtained using the dense direct solver
+    int n = 40;
+    vector_int rowStart, cols;
+    tridiagonal(n, rowStart, cols);
+    SparseJacobian J(n, rowStart, cols);
+
+    DiffusionReaction f1(n);
+    IDA_Solver dense(f1);
+    dense.setTolerances(1e-8, 1e-12);
+    dense.setDenseLinearSolver();
+    dense.init(0.0);
+    dense.solve(0.05);
+
+    DiffusionReaction f2(n);
+    IDA_Solver sparse(f2);
+    sparse.setTolerances(1e-8, 1e-12);
+    sparse.setSparseLinearSolver(J);
+    sparse.init(0.0);
+    sparse.solve(0.05);
+
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(dense.solution(i), sparse.solution(i), 1e-6);
+    }
+
+    // The size of the Jacobian must match the problem
+    tridiagonal(3, rowStart, cols);
+    SparseJacobian small(3, rowStart, cols);
+    EXPECT_THROW(sparse.setSparseLinearSolver(small), CanteraError);
+}
+#endif
+
+}
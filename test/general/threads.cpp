@@ -0,0 +1,390 @@
+#include "gtest/gtest.h"
+#include "cantera/base/ct_thread.h"
+#include "cantera/base/global.h"
+#include "cantera/base/logger.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/xml.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/transport/TransportFactory.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+namespace Cantera
+{
+
+//! Work done by each thread in a test
+class ThreadTask
+{
+public:
+    virtual ~ThreadTask() {}
+    virtual void run() = 0;
+};
+
+static void* runTask(void* task)
+{
+    static_cast<ThreadTask*>(task)->run();
+    thread_complete();
+    return 0;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI runTaskWin(LPVOID task)
+{
+    runTask(task);
+    return 0;
+}
+#endif
+
+//! Run each of the tasks in a separate thread, and wait for all of them to
+//! finish.
+static void runConcurrently(std::vector<ThreadTask*>& tasks)
+{
+#ifdef _WIN32
+    std::vector<HANDLE> threads;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        threads.push_back(CreateThread(0, 0, runTaskWin, tasks[i], 0, 0));
+        ASSERT_TRUE(threads.back() != 0);
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+    }
+#else
+    std::vector<pthread_t> threads(tasks.size());
+    for (size_t i = 0; i < tasks.size(); i++) {
+        ASSERT_EQ(0, pthread_create(&threads[i], 0, runTask, tasks[i]));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        pthread_join(threads[i], 0);
+    }
+#endif
+}
+
+//! Sleep for a millisecond
+static void sleepBriefly()
+{
+#ifdef _WIN32
+    Sleep(1);
+#else
+    usleep(1000);
+#endif
+}
+
+//! A flag which can be set by one thread and waited for by another
+class Flag
+{
+public:
+    Flag() : m_set(false) {}
+    void set() {
+        ScopedLock lock(m_mutex);
+        m_set = true;
+    }
+    void wait() {
+        while (true) {
+            {
+                ScopedLock lock(m_mutex);
+                if (m_set) {
+                    return;
+                }
+            }
+            sleepBriefly();
+        }
+    }
+private:
+    mutex_t m_mutex;
+    bool m_set;
+};
+
+const int nThreads = 8;
+
+class CreateObjectsTask : public ThreadTask
+{
+public:
+    CreateObjectsTask() : nSpecies(0), nReactions(0), visc(0.0), wdot(0.0),
+        failed(false) {}
+
+    virtual void run() {
+        try {
+            for (int i = 0; i < 5; i++) {
+                ThermoPhase* gas = newPhase("h2o2.xml");
+                std::vector<ThermoPhase*> phases(1, gas);
+                Kinetics* kin = newKineticsMgr(gas->xml(), phases);
+                Transport* tran = newDefaultTransportMgr(gas);
+                gas->setState_TPX(1200.0, OneAtm, "H2:2, O2:1, H:0.01");
+                nSpecies = gas->nSpecies();
+                nReactions = kin->nReactions();
+                visc = tran->viscosity();
+                vector_fp w(nSpecies);
+                kin->getNetProductionRates(&w[0]);
+                wdot = w[gas->speciesIndex("H2O")];
+                delete tran;
+                delete kin;
+                delete gas;
+            }
+        } catch (CanteraError&) {
+            failed = true;
+        }
+    }
+
+    size_t nSpecies, nReactions;
+    double visc, wdot;
+    bool failed;
+};
+
+TEST(ThreadSafety, create_objects)
+{
+    CreateObjectsTask ref;
+    ref.run();
+    ASSERT_FALSE(ref.failed);
+
+    std::vector<CreateObjectsTask> tasks(nThreads);
+    std::vector<ThreadTask*> ptrs;
+    for (int i = 0; i < nThreads; i++) {
+        ptrs.push_back(&tasks[i]);
+    }
+    runConcurrently(ptrs);
+    for (int i = 0; i < nThreads; i++) {
+        EXPECT_FALSE(tasks[i].failed);
+        EXPECT_EQ(ref.nSpecies, tasks[i].nSpecies);
+        EXPECT_EQ(ref.nReactions, tasks[i].nReactions);
+        EXPECT_DOUBLE_EQ(ref.visc, tasks[i].visc);
+        EXPECT_DOUBLE_EQ(ref.wdot, tasks[i].wdot);
+    }
+}
+
+class XmlCacheTask : public ThreadTask
+{
+public:
+    XmlCacheTask() : failed(false) {}
+
+    virtual void run() {
+        const char* files[] = {"h2o2.xml", "gri30.xml", "air.xml"};
+        try {
+            for (int i = 0; i < 20; i++) {
+                for (int j = 0; j < 3; j++) {
+                    XML_Node* root = get_XML_File(files[j]);
+                    nodes[j] = root;
+                    if (!root->findByName("phase")) {
+                        failed = true;
+                    }
+                }
+            }
+        } catch (CanteraError&) {
+            failed = true;
+        }
+    }
+
+    XML_Node* nodes[3];
+    bool failed;
+};
+
+TEST(ThreadSafety, xml_cache)
+{
+    close_XML_File("all");
+    std::vector<XmlCacheTask> tasks(nThreads);
+    std::vector<ThreadTask*> ptrs;
+    for (int i = 0; i < nThreads; i++) {
+        ptrs.push_back(&tasks[i]);
+    }
+    runConcurrently(ptrs);
+    for (int i = 0; i < nThreads; i++) {
+        ASSERT_FALSE(tasks[i].failed);
+        for (int j = 0; j < 3; j++) {
+            // Every thread should get the same cached tree for each file
+            EXPECT_EQ(tasks[0].nodes[j], tasks[i].nodes[j]);
+        }
+    }
+}
+
+class ErrorStackTask : public ThreadTask
+{
+public:
+    explicit ErrorStackTask(int n=0) : nAdded(n), count(-1) {}
+
+    virtual void run() {
+        for (int i = 0; i < nAdded; i++) {
+            setError("ErrorStackTask", "error " + int2str(i));
+        }
+        count = nErrors();
+    }
+
+    int nAdded;
+    int count;
+};
+
+TEST(ThreadSafety, error_stacks)
+{
+    int n0 = nErrors();
+    std::vector<ErrorStackTask> tasks;
+    std::vector<ThreadTask*> ptrs;
+    for (int i = 0; i < nThreads; i++) {
+        tasks.push_back(ErrorStackTask(10 * (i + 1)));
+    }
+    for (int i = 0; i < nThreads; i++) {
+        ptrs.push_back(&tasks[i]);
+    }
+    runConcurrently(ptrs);
+    for (int i = 0; i < nThreads; i++) {
+        EXPECT_EQ(10 * (i + 1), tasks[i].count);
+    }
+    EXPECT_EQ(n0, nErrors());
+}
+
+class LockedStringLogger : public Logger
+{
+public:
+    explicit LockedStringLogger(std::string& out) : m_out(out) {}
+    virtual void write(const std::string& msg) {
+        ScopedLock lock(m_mutex);
+        m_out += msg;
+    }
+    virtual void writeendl() {
+        ScopedLock lock(m_mutex);
+        m_out += "\n";
+    }
+    std::string& m_out;
+    mutex_t m_mutex;
+};
+
+class LoggingTask : public ThreadTask
+{
+public:
+    explicit LoggingTask(int id=0) : m_id(id) {}
+
+    virtual void run() {
+        for (int i = 0; i < 50; i++) {
+            writelog("thread ");
+            writelog(int2str(m_id));
+            writelog(" line ");
+            writelog(int2str(i) + "\n");
+        }
+    }
+
+    int m_id;
+};
+
+TEST(ThreadSafety, logging)
+{
+    std::string output;
+    setLogger(new LockedStringLogger(output));
+    std::vector<LoggingTask> tasks;
+    std::vector<ThreadTask*> ptrs;
+    for (int i = 0; i < nThreads; i++) {
+        tasks.push_back(LoggingTask(i));
+    }
+    for (int i = 0; i < nThreads; i++) {
+        ptrs.push_back(&tasks[i]);
+    }
+    runConcurrently(ptrs);
+    setLogger(new Logger());
+
+    // Lines written by different threads should not be mixed together
+    for (int i = 0; i < nThreads; i++) {
+        for (int j = 0; j < 50; j++) {
+            std::string line = "thread " + int2str(i) + " line " +
+                               int2str(j) + "\n";
+            EXPECT_NE(std::string::npos, output.find(line)) << line;
+        }
+    }
+    EXPECT_EQ((size_t) (50 * nThreads),
+              (size_t) std::count(output.begin(), output.end(), '\n'));
+}
+
+//! A lock which is held by threads while they use the logger, and which the
+//! logger acquires if the calling thread does not already hold it, like the
+//! Python GIL and the Python logger.
+class GlobalLock
+{
+public:
+    GlobalLock() : m_holder(0) {}
+    void acquire() {
+        m_mutex.lock();
+        m_holder.set(this);
+    }
+    void release() {
+        m_holder.set(0);
+        m_mutex.unlock();
+    }
+    bool held() const {
+        return m_holder.get() != 0;
+    }
+private:
+    mutex_t m_mutex;
+    ThreadSpecificKey m_holder;
+};
+
+class GlobalLockLogger : public Logger
+{
+public:
+    GlobalLockLogger(GlobalLock& gil, Flag& waiting, std::string& out) :
+        m_gil(gil), m_waiting(waiting), m_out(out) {}
+    virtual void write(const std::string& msg) {
+        if (m_gil.held()) {
+            m_out += msg;
+        } else {
+            m_waiting.set();
+            m_gil.acquire();
+            m_out += msg;
+            m_gil.release();
+        }
+    }
+    GlobalLock& m_gil;
+    Flag& m_waiting;
+    std::string& m_out;
+};
+
+//! Logs while holding the global lock, after the other thread has started
+//! to wait for it from inside the logger
+class LogWithLockTask : public ThreadTask
+{
+public:
+    LogWithLockTask(GlobalLock& gil, Flag& locked, Flag& waiting) :
+        m_gil(gil), m_locked(locked), m_waiting(waiting) {}
+    virtual void run() {
+        m_gil.acquire();
+        m_locked.set();
+        m_waiting.wait();
+        writelog("with lock\n");
+        m_gil.release();
+    }
+    GlobalLock& m_gil;
+    Flag& m_locked;
+    Flag& m_waiting;
+};
+
+//! Logs without holding the global lock, while the other thread holds it
+class LogWithoutLockTask : public ThreadTask
+{
+public:
+    explicit LogWithoutLockTask(Flag& locked) : m_locked(locked) {}
+    virtual void run() {
+        m_locked.wait();
+        writelog("without lock\n");
+    }
+    Flag& m_locked;
+};
+
+TEST(ThreadSafety, logger_with_lock)
+{
+    // This deadlocks if Cantera holds its own lock while calling the logger
+    std::string output;
+    GlobalLock gil;
+    Flag locked, waiting;
+    setLogger(new GlobalLockLogger(gil, waiting, output));
+    LogWithLockTask withLock(gil, locked, waiting);
+    LogWithoutLockTask withoutLock(locked);
+    std::vector<ThreadTask*> ptrs;
+    ptrs.push_back(&withLock);
+    ptrs.push_back(&withoutLock);
+    runConcurrently(ptrs);
+    setLogger(new Logger());
+    EXPECT_EQ("with lock\nwithout lock\n", output);
+}
+
+}
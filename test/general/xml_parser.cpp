@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+#include "cantera/base/xml.h"
+#include "cantera/base/ctml.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <sstream>
+
+using namespace Cantera;
+
+// The expected results, including the handling of entities and malformed
+// input, are those of the reader which read its input one character at a
+// time from the stream.
+class XmlParserTest : public testing::Test
+{
+public:
+    XmlParserTest() : root("--") {}
+
+    void build(const std::string& text) {
+        std::istringstream s(text);
+        root.build(s);
+    }
+
+    XML_Node root;
+};
+
+TEST_F(XmlParserTest, attributes)
+{
+    build("<?xml version=\"1.0\"?>\n"
+          "<phase id=\"gas\" dim=\"3\"\n"
+          "       model = \"ideal\" empty=\"\">\n"
+          "  <state T=\"300.0\" P=\"1e5\"/>\n"
+          "  <quoted text='say \"hi\"' escaped=\"a \\\" b\"/>\n"
+          "</phase>\n");
+    ASSERT_EQ((size_t) 1, root.nChildren());
+    XML_Node& phase = root.child(0);
+    EXPECT_EQ("phase", phase.name());
+    EXPECT_EQ("gas", phase.attrib("id"));
+    EXPECT_EQ("3", phase.attrib("dim"));
+    EXPECT_EQ("ideal", phase.attrib("model"));
+    EXPECT_TRUE(phase.hasAttrib("empty"));
+    EXPECT_EQ("", phase.attrib("empty"));
+    EXPECT_FALSE(phase.hasAttrib("missing"));
+    // Line numbers count from zero, and refer to the end of the start tag
+    EXPECT_EQ(2, phase.lineNumber());
+
+    XML_Node& state = phase.child("state");
+    EXPECT_EQ("300.0", state.attrib("T"));
+    EXPECT_EQ("1e5", state.attrib("P"));
+    EXPECT_EQ("", state.value());
+    EXPECT_EQ(0, (int) state.nChildren());
+    EXPECT_EQ(3, state.lineNumber());
+
+    XML_Node& quoted = phase.child("quoted");
+    EXPECT_EQ("say \"hi\"", quoted.attrib("text"));
+    EXPECT_EQ("a \\\" b", quoted.attrib("escaped"));
+}
+
+TEST_F(XmlParserTest, entities)
+{
+    // Entities are neither expanded nor rejected
+    build("<ctml>\n"
+          "  <note title=\"x &amp; y\">a &lt; b &amp;&amp; c &gt; d</note>\n"
+          "  <sym>&#945;&#x3B2;</sym>\n"
+          "</ctml>\n");
+    XML_Node& ctml = root.child("ctml");
+    EXPECT_EQ("x &amp; y", ctml.child("note").attrib("title"));
+    EXPECT_EQ("a &lt; b &amp;&amp; c &gt; d", ctml.child("note").value());
+    EXPECT_EQ("&#945;&#x3B2;", ctml.child("sym").value());
+}
+
+TEST_F(XmlParserTest, nested_nodes)
+{
+    build("<ctml>\n"
+          "  <!-- comment with <tags> and -- dashes -->\n"
+          "  <a id=\"first\">\n"
+          "    <b>  1.0, 2.0,\n"
+          "         3.0  </b>\n"
+          "    <b>\n"
+          "      second\n"
+          "    </b>\n"
+          "    <c><d><e>deep</e></d></c>\n"
+          "  </a>\n"
+          "  <a id=\"second\"/>\n"
+          "</ctml>\n");
+    XML_Node& ctml = root.child("ctml");
+    EXPECT_EQ(3, (int) ctml.nChildren());
+    EXPECT_EQ(2, (int) ctml.nChildren(true));
+    EXPECT_TRUE(ctml.child(0).isComment());
+    EXPECT_EQ(" comment with <tags> and -- dashes ", ctml.child(0).value());
+
+    XML_Node& a = ctml.child(1);
+    EXPECT_EQ("first", a.attrib("id"));
+    EXPECT_EQ(&ctml, a.parent());
+    EXPECT_EQ(&root, &a.root());
+    ASSERT_EQ(3, (int) a.nChildren());
+    // Indentation is collapsed to a single space, but line breaks are kept
+    EXPECT_EQ("1.0, 2.0,\n 3.0", a.child(0).value());
+    EXPECT_EQ(3, a.child(0).lineNumber());
+    EXPECT_EQ("second", a.child(1).value());
+    EXPECT_EQ("deep", a.child("c/d/e").value());
+    EXPECT_EQ(8, a.child("c/d/e").lineNumber());
+
+    EXPECT_EQ("second", ctml.child(2).attrib("id"));
+    EXPECT_EQ(0, (int) ctml.child(2).nChildren());
+    EXPECT_EQ(10, ctml.child(2).lineNumber());
+    EXPECT_EQ(&ctml.child(2), root.findByAttr("id", "second"));
+}
+
+TEST_F(XmlParserTest, mismatched_tags)
+{
+    EXPECT_THROW(build("<ctml>\n  <a>\n    <b>1</c>\n  </a>\n</ctml>\n"),
+                 CanteraError);
+}
+
+TEST_F(XmlParserTest, extra_closing_tag)
+{
+    EXPECT_THROW(build("<ctml>\n  <a/>\n</a>\n"), CanteraError);
+}
+
+TEST_F(XmlParserTest, truncated_input)
+{
+    // Unclosed elements and an incomplete final tag are not errors
+    build("<ctml>\n  <a>\n    <b>1.0</b>\n    <c x=\"1\"");
+    XML_Node& a = root.child("ctml").child("a");
+    EXPECT_EQ(1, (int) a.nChildren());
+    EXPECT_EQ("1.0", a.child("b").value());
+}
+
+TEST_F(XmlParserTest, unterminated_comment)
+{
+    build("<ctml>\n  <a>1</a>\n  <!-- never closed <b>2</b>\n</ctml>\n");
+    XML_Node& ctml = root.child("ctml");
+    EXPECT_EQ(1, (int) ctml.nChildren());
+    EXPECT_EQ("1", ctml.child("a").value());
+}
+
+TEST_F(XmlParserTest, float_array)
+{
+    build("<ctml>\n"
+          "  <floatArray size=\"6\" units=\"cm\">\n"
+          "    1.0, -2.5e-3,\n"
+          "    3, 4.0E+2 ,\n"
+          "    .5,6.\n"
+          "  </floatArray>\n"
+          "  <floatArray title=\"bad\"> 1.0, 2.0x </floatArray>\n"
+          "</ctml>\n");
+    XML_Node& ctml = root.child("ctml");
+    vector_fp v;
+    ASSERT_EQ((size_t) 6, ctml::getFloatArray(ctml.child(0), v, true, "length"));
+    const double expected[] = {0.01, -2.5e-5, 0.03, 4.0, 0.005, 0.06};
+    for (size_t i = 0; i < 6; i++) {
+        EXPECT_DOUBLE_EQ(expected[i], v[i]);
+    }
+    EXPECT_THROW(ctml::getFloatArray(ctml.child(1), v, false), CanteraError);
+}
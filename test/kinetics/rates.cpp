@@ -69,6 +69,40 @@ TEST_F(FracCoeffTest, StoichCoeffs)
     EXPECT_DOUBLE_EQ(1.0, kin.productStoichCoeff(kH2O, 1));
 }
 
+TEST_F(FracCoeffTest, StoichMatrices)
+{
+    const StoichMatrix& reac = kin.reactantStoichCoeffs();
+    const StoichMatrix& prod = kin.productStoichCoeffs();
+    const StoichMatrix& net = kin.netStoichCoeffs();
+    ASSERT_EQ(therm.nSpecies(), net.nRows());
+    ASSERT_EQ(kin.nReactions(), net.nColumns());
+    for (size_t k = 0; k < therm.nSpecies(); k++) {
+        for (size_t i = 0; i < kin.nReactions(); i++) {
+            EXPECT_DOUBLE_EQ(kin.reactantStoichCoeff(k, i), reac(k, i));
+            EXPECT_DOUBLE_EQ(kin.productStoichCoeff(k, i), prod(k, i));
+            EXPECT_DOUBLE_EQ(kin.productStoichCoeff(k, i) -
+                             kin.reactantStoichCoeff(k, i), net(k, i));
+        }
+    }
+
+    // products with the matrix and its transpose
+    vector_fp x(kin.nReactions(), 0.0), y(therm.nSpecies(), 0.0);
+    vector_fp z(therm.nSpecies(), 0.0), w(kin.nReactions(), 0.0);
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        x[i] = i + 1.0;
+    }
+    for (size_t k = 0; k < therm.nSpecies(); k++) {
+        z[k] = k + 1.0;
+    }
+    net.mult(&x[0], &y[0]);
+    EXPECT_DOUBLE_EQ(1.4*x[0], y[kH]);
+    EXPECT_DOUBLE_EQ(-x[0] + x[1] + x[2], y[kH2O]);
+    EXPECT_DOUBLE_EQ(-0.7*x[1] - x[2], y[kH2]);
+    net.multTranspose(&z[0], &w[0]);
+    EXPECT_DOUBLE_EQ(-z[kH2O] + 1.4*z[kH] + 0.6*z[kOH] + 0.2*z[kO2], w[0]);
+    EXPECT_DOUBLE_EQ(z[kH2O] - z[kH2] - 0.5*z[kO2], w[2]);
+}
+
 TEST_F(FracCoeffTest, RateConstants)
 {
     vector_fp kf(kin.nReactions(), 0.0);
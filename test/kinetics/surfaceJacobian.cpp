@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/solveSP.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/base/Array.h"
+
+using namespace Cantera;
+
+class SurfaceJacobianTest : public testing::Test
+{
+public:
+    SurfaceJacobianTest()
+        : gas("ptcombust.xml", "gas")
+        , surf("ptcombust.xml", "Pt_surf")
+    {
+        std::vector<ThermoPhase*> th;
+        th.push_back(&gas);
+        th.push_back(&surf);
+        importKinetics(surf.xml(), th, &kin);
+        gas.setState_TPX(900.0, OneAtm, "CH4:0.095, O2:0.21, AR:0.695");
+        surf.setTemperature(900.0);
+        surf.setCoveragesByName("PT(S):0.3, H(S):0.1, H2O(S):0.05, "
+                                "OH(S):0.05, CO(S):0.1, CO2(S):0.05, "
+                                "CH3(S):0.05, CH2(S)s:0.05, CH(S):0.05, "
+                                "C(S):0.05, O(S):0.15");
+    }
+
+    IdealGasPhase gas;
+    SurfPhase surf;
+    InterfaceKinetics kin;
+};
+
+TEST_F(SurfaceJacobianTest, analytic_vs_finite_difference)
+{
+    size_t nsp = surf.nSpecies();
+    Array2D dwdot(kin.nTotalSpecies(), nsp);
+    kin.getNetProductionRates_ddC(dwdot);
+    vector_fp rowMax(kin.nTotalSpecies(), 0.0);
+    for (size_t i = 0; i < kin.nTotalSpecies(); i++) {
+        for (size_t j = 0; j < nsp; j++) {
+            rowMax[i] = std::max(rowMax[i], std::abs(dwdot(i, j)));
+        }
+    }
+
+    // Central differences. The error is compared to the largest derivative
+    // in each row, since round-off in the net rates of progress of fast
+    // reactions dominates the finite difference approximation of the small
+    // derivatives.
+    vector_fp conc(nsp), wdot0(kin.nTotalSpecies()), wdot1(kin.nTotalSpecies());
+    surf.getConcentrations(&conc[0]);
+    for (size_t j = 0; j < nsp; j++) {
+        vector_fp c = conc;
+        double dc = 1e-5 * c[j];
+        c[j] = conc[j] - dc;
+        surf.setConcentrations(&c[0]);
+        kin.getNetProductionRates(&wdot0[0]);
+        c[j] = conc[j] + dc;
+        surf.setConcentrations(&c[0]);
+        kin.getNetProductionRates(&wdot1[0]);
+        for (size_t i = 0; i < kin.nTotalSpecies(); i++) {
+            double fd = (wdot1[i] - wdot0[i]) / (2 * dc);
+            EXPECT_NEAR(fd, dwdot(i, j), 1e-6 * rowMax[i])
+                << "species " << kin.kineticsSpeciesName(i) << ", column "
+                << surf.speciesName(j);
+        }
+    }
+    surf.setConcentrations(&conc[0]);
+}
+
+TEST_F(SurfaceJacobianTest, solveSP_analytic_vs_numerical)
+{
+    std::vector<InterfaceKinetics*> kinVec(1, &kin);
+    ImplicitSurfChem surfChem(kinVec);
+    size_t nsp = surf.nSpecies();
+    vector_fp c0(nsp), cAnalytic(nsp), cNumerical(nsp);
+    surf.getConcentrations(&c0[0]);
+
+    solveSP analytic(&surfChem, BULK_ETCH);
+    ASSERT_EQ(1, analytic.solveSurfProb(SFLUX_INITIALIZE, 1.0, 900.0, OneAtm,
+                                        1e-8, 1e-20));
+    surf.getConcentrations(&cAnalytic[0]);
+
+    surf.setConcentrations(&c0[0]);
+    solveSP numerical(&surfChem, BULK_ETCH);
+    numerical.m_numericalJacobian = true;
+    ASSERT_EQ(1, numerical.solveSurfProb(SFLUX_INITIALIZE, 1.0, 900.0, OneAtm,
+                                         1e-8, 1e-20));
+    surf.getConcentrations(&cNumerical[0]);
+
+    double sd = surf.siteDensity();
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(cNumerical[k], cAnalytic[k], 1e-6 * sd)
+            << surf.speciesName(k);
+    }
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/HMWSoln.h"
+
+namespace Cantera
+{
+
+// Reference values were computed before the Pitzer interaction loops were
+// restricted to the nonzero interactions. The mixture includes a like-charge
+// pair with only E-theta contributions (H+ / Ca++), a cation-anion pair with
+// no parameters (H+ / OH-) and a neutral species with Lambda parameters.
+class HMWSoln_Test : public testing::Test
+{
+public:
+    HMWSoln_Test()
+        : test_phase("../data/HMW_NaCl_CaCl2.xml", "NaCl_electrolyte") {
+    }
+
+    void check(const double* gamma_ref, const double* h_ref,
+               const double* cp_ref, double osmotic_ref) {
+        size_t kk = test_phase.nSpecies();
+        ASSERT_EQ((size_t) 7, kk);
+        vector_fp gamma(kk), h(kk), cp(kk);
+        test_phase.getMolalityActivityCoefficients(&gamma[0]);
+        test_phase.getPartialMolarEnthalpies(&h[0]);
+        test_phase.getPartialMolarCp(&cp[0]);
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(gamma_ref[k], gamma[k], 1e-12 * gamma_ref[k])
+                << test_phase.speciesName(k);
+            EXPECT_NEAR(h_ref[k], h[k], 1e-10 * std::abs(h_ref[k]) + 1e-4)
+                << test_phase.speciesName(k);
+            EXPECT_NEAR(cp_ref[k], cp[k], 1e-10 * std::abs(cp_ref[k]) + 1e-4)
+                << test_phase.speciesName(k);
+        }
+        EXPECT_NEAR(osmotic_ref, test_phase.osmoticCoefficient(),
+                    1e-12 * osmotic_ref);
+    }
+
+    HMWSoln test_phase;
+};
+
+TEST_F(HMWSoln_Test, activity_coefficients_298K)
+{
+    test_phase.setState_TP(298.15, OneAtm);
+    const double gamma[] = {0.86879127099217801, 1.3628434969482841,
+                            5.6763416969935454, 1.1334512581434331,
+                            0.43544997668745811, 2.4060009853193036,
+                            3.1522800422966673};
+    const double h[] = {-285872167.86912, -1621923.1082199006,
+                        1861104.4802317615, -2193341.3461956033,
+                        1861104.4802317615, 4076355.1322194403, 0.0};
+    const double cp[] = {69747.76163077743, 53625.937959256975,
+                         -10218.444434887315, 64100.114107950612,
+                         -10218.444434887315, -16977.912568574444, 0.0};
+    check(gamma, h, cp, 1.459281018567294);
+}
+
+TEST_F(HMWSoln_Test, activity_coefficients_323K)
+{
+    test_phase.setState_TP(323.15, OneAtm);
+    const double gamma[] = {0.87137035682576136, 1.4071279116955535,
+                            5.3763874674416972, 1.1869624015801361,
+                            0.4124395468652301, 2.1317611222475432,
+                            3.1522800422966673};
+    const double h[] = {-284108636.52402848, -450678.83127197489,
+                        1614485.5284537943, -789485.38666075026,
+                        1614485.5284537943, 3676813.9988537692, 0.0};
+    const double cp[] = {71331.332939542364, 40488.822383279876,
+                         -9507.2632417245568, 48691.075861873687,
+                         -9507.2632417245568, -14970.144238177654, 0.0};
+    check(gamma, h, cp, 1.4473500405645441);
+}
+
+}
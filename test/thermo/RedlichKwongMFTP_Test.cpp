@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+
+namespace Cantera
+{
+
+class RedlichKwongMFTP_Test : public testing::Test
+{
+public:
+    RedlichKwongMFTP_Test()
+        : test_phase("../data/co2_redlichkwong.xml", "co2-h2o-h2")
+        , fresh_phase("../data/co2_redlichkwong.xml", "co2-h2o-h2") {
+    }
+
+    //! Check that the cached mixture parameters of *test_phase* give the same
+    //! properties as a phase set directly to the same state
+    void checkEquivalent(double T, double P, const double* X) {
+        fresh_phase.setState_TPX(T, P, X);
+        EXPECT_DOUBLE_EQ(fresh_phase.density(), test_phase.density());
+        EXPECT_DOUBLE_EQ(fresh_phase.enthalpy_mole(), test_phase.enthalpy_mole());
+        EXPECT_DOUBLE_EQ(fresh_phase.entropy_mole(), test_phase.entropy_mole());
+        EXPECT_DOUBLE_EQ(fresh_phase.cp_mole(), test_phase.cp_mole());
+        EXPECT_DOUBLE_EQ(fresh_phase.critTemperature(),
+                         test_phase.critTemperature());
+        EXPECT_DOUBLE_EQ(fresh_phase.critPressure(), test_phase.critPressure());
+
+        size_t kk = test_phase.nSpecies();
+        vector_fp v1(kk), v2(kk);
+        fresh_phase.getPartialMolarEnthalpies(&v1[0]);
+        test_phase.getPartialMolarEnthalpies(&v2[0]);
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(v1[k], v2[k]);
+        }
+        fresh_phase.getPartialMolarVolumes(&v1[0]);
+        test_phase.getPartialMolarVolumes(&v2[0]);
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(v1[k], v2[k]);
+        }
+        fresh_phase.getChemPotentials(&v1[0]);
+        test_phase.getChemPotentials(&v2[0]);
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(v1[k], v2[k]);
+        }
+    }
+
+protected:
+    RedlichKwongMFTP test_phase;
+    RedlichKwongMFTP fresh_phase;
+};
+
+TEST_F(RedlichKwongMFTP_Test, StateChanges)
+{
+    double X1[] = {0.7, 0.2, 0.1};
+    double X2[] = {0.5, 0.0, 0.5};
+    test_phase.setState_TPX(400.0, 5.0E6, X1);
+
+    // Change only the temperature, then only the pressure
+    test_phase.setState_TP(500.0, 5.0E6);
+    checkEquivalent(500.0, 5.0E6, X1);
+    test_phase.setState_TP(500.0, 1.0E7);
+    checkEquivalent(500.0, 1.0E7, X1);
+
+    // Change only the composition
+    ThermoPhase& tp = test_phase;
+    tp.setMoleFractions(X2);
+    test_phase.setState_TP(500.0, 1.0E7);
+    checkEquivalent(500.0, 1.0E7, X2);
+
+    // Copies recompute the mixture parameters
+    RedlichKwongMFTP copy(test_phase);
+    copy.setState_TP(600.0, 2.0E7);
+    test_phase.setState_TP(600.0, 2.0E7);
+    EXPECT_DOUBLE_EQ(test_phase.density(), copy.density());
+    EXPECT_DOUBLE_EQ(test_phase.enthalpy_mole(), copy.enthalpy_mole());
+}
+
+TEST(RedlichKwongMFTP_ConstantA, CriticalProperties)
+{
+    RedlichKwongMFTP co2("../data/co2_redlichkwong.xml", "co2-constant-a");
+    double a = 6.46e6;
+    double b = 29.7e-3;
+    double Tc = pow(a * RedlichKwongMFTP::omega_b /
+                    (b * RedlichKwongMFTP::omega_a * GasConstant), 2.0/3.0);
+    EXPECT_NEAR(Tc, co2.critTemperature(), 1e-10 * Tc);
+    double Pc = RedlichKwongMFTP::omega_b * GasConstant * Tc / b;
+    EXPECT_NEAR(Pc, co2.critPressure(), 1e-10 * Pc);
+
+    // The pressure computed from the equation of state is consistent with
+    // the density found for it
+    co2.setState_TP(350.0, 5.0E6);
+    double v = co2.molarVolume();
+    double P = GasConstant * 350.0 / (v - b) - a / (sqrt(350.0) * v * (v + b));
+    EXPECT_NEAR(5.0E6, P, 1e-6 * 5.0E6);
+}
+
+} // namespace Cantera
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "cantera/tpx/utils.h"
+#include <cmath>
+
+namespace tpx
+{
+
+class Substance_Test : public testing::TestWithParam<int>
+{
+public:
+    Substance_Test() :
+        batch(GetSub(GetParam())),
+        single(GetSub(GetParam())) {
+    }
+
+    ~Substance_Test() {
+        delete batch;
+        delete single;
+    }
+
+    // Compare the states set with setStates against those set one at a
+    // time, without the saturation table
+    void checkStates(PropertyPair::type XY, const std::vector<double>& x,
+                     const std::vector<double>& y) {
+        size_t n = x.size();
+        std::vector<double> T(n), v(n);
+        batch->setStates(XY, n, &x[0], &y[0], &T[0], &v[0]);
+        for (size_t i = 0; i < n; i++) {
+            single->Set(XY, x[i], y[i]);
+            EXPECT_NEAR(single->Temp(), T[i], 1e-6 * T[i]) << "state " << i;
+            EXPECT_NEAR(single->v(), v[i], 1e-5 * v[i]) << "state " << i;
+        }
+        EXPECT_DOUBLE_EQ(T[n-1], batch->Temp());
+        EXPECT_DOUBLE_EQ(v[n-1], batch->v());
+    }
+
+    Substance* batch;
+    Substance* single;
+};
+
+TEST_P(Substance_Test, SaturationTable)
+{
+    batch->buildSatTable(50);
+    ASSERT_TRUE(batch->hasSatTable());
+    EXPECT_FALSE(single->hasSatTable());
+    double Tc = single->Tcrit();
+    double Tmin = single->Tmin();
+    for (int i = 1; i < 10; i++) {
+        double T = Tmin + 0.1 * i * (Tc - Tmin);
+        batch->Set(PropertyPair::TX, T, 0.5);
+        single->Set(PropertyPair::TX, T, 0.5);
+        EXPECT_NEAR(single->Ps(), batch->Ps(), 1e-7 * single->Ps());
+        EXPECT_NEAR(single->v(), batch->v(), 1e-7 * single->v());
+        double p = single->Ps();
+        EXPECT_NEAR(single->Tsat(p), batch->Tsat(p), 1e-6 * T);
+    }
+}
+
+TEST_P(Substance_Test, SetStatesTP)
+{
+    single->Set(PropertyPair::TX, 0.5 * (single->Tmin() + single->Tcrit()),
+                0.0);
+    double Psat = single->Ps();
+    double Tmax = std::min(single->Tmax(), 2.0 * single->Tcrit());
+    double Tmin = single->Tmin() + 10.0;
+    std::vector<double> T, P;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 5; j++) {
+            T.push_back(Tmin + i * (Tmax - Tmin) / 7.0);
+            P.push_back(Psat * pow(3.0, j - 2));
+        }
+    }
+    checkStates(PropertyPair::TP, T, P);
+}
+
+TEST_P(Substance_Test, SetStatesHP)
+{
+    // Enthalpies spanning the two-phase region at several pressures
+    double Tmid = 0.5 * (single->Tmin() + single->Tcrit());
+    single->Set(PropertyPair::TX, Tmid, 0.0);
+    double hf = single->h();
+    double Psat = single->Ps();
+    single->Set(PropertyPair::TX, Tmid, 1.0);
+    double hg = single->h();
+    std::vector<double> h, P;
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 3; j++) {
+            h.push_back(hf + (0.15 * i - 0.1) * (hg - hf));
+            P.push_back(Psat * pow(2.0, j - 1));
+        }
+    }
+    checkStates(PropertyPair::HP, h, P);
+}
+
+TEST_P(Substance_Test, SetStatesInvalid)
+{
+    double T[2] = {300.0, -10.0};
+    double P[2] = {1e5, 1e5};
+    double Tout[2], vout[2];
+    EXPECT_THROW(batch->setStates(PropertyPair::TP, 2, T, P, Tout, vout),
+                 TPX_Error);
+}
+
+// water, nitrogen, methane, HFC134a, carbon dioxide
+INSTANTIATE_TEST_CASE_P(Fluids, Substance_Test,
+                        testing::Values(0, 1, 2, 5, 7));
+
+}
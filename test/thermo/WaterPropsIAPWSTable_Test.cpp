@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+class WaterPropsIAPWSTableTest : public testing::Test
+{
+public:
+    WaterPropsIAPWSTableTest()
+        : table(300.0, 500.0, 21, 1.0E4, 1.0E7, 16, 1.0E-5) {
+        tabulated.setTable(&table);
+    }
+
+protected:
+    WaterPropsIAPWSTable table;
+    WaterPropsIAPWS exact;
+    WaterPropsIAPWS tabulated;
+};
+
+TEST_F(WaterPropsIAPWSTableTest, ErrorBound)
+{
+    EXPECT_LE(table.maxError(), 1.0E-5);
+    EXPECT_GT(table.coverage(), 0.5);
+
+    for (double T = 303.0; T < 500.0; T += 17.0) {
+        for (double P = 1.2E4; P < 1.0E7; P *= 3.0) {
+            double rhoLiq = table.density(T, P, WATER_LIQUID);
+            if (rhoLiq > 0.0) {
+                double rho = exact.density(T, P, WATER_LIQUID);
+                EXPECT_NEAR(rho, rhoLiq, 1.0E-5 * rho);
+            }
+            double rhoGas = table.density(T, P, WATER_GAS);
+            if (rhoGas > 0.0) {
+                double rho = exact.density(T, P, WATER_GAS);
+                EXPECT_NEAR(rho, rhoGas, 1.0E-5 * rho);
+            }
+        }
+    }
+}
+
+TEST_F(WaterPropsIAPWSTableTest, OutOfRange)
+{
+    double rhoLiq, rhoGas;
+    EXPECT_EQ(-1.0, table.density(250.0, 1.0E5, WATER_LIQUID));
+    EXPECT_EQ(-1.0, table.density(400.0, 1.0E8, WATER_LIQUID));
+    EXPECT_EQ(-1.0, table.density(350.0, 1.0E6, WATER_GAS));
+    EXPECT_EQ(-1.0, table.psat(600.0, rhoLiq, rhoGas));
+    ASSERT_THROW(WaterPropsIAPWSTable(300.0, 700.0), CanteraError);
+}
+
+TEST_F(WaterPropsIAPWSTableTest, Density)
+{
+    // Inside and outside of the range of the table
+    const double T[] = {300.0, 337.2, 373.15, 450.0, 520.0};
+    const double P[] = {2.0E4, 1.0E5, 3.0E6, 5.0E7};
+    for (size_t i = 0; i < 5; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            double rho = exact.density(T[i], P[j], WATER_LIQUID);
+            EXPECT_NEAR(rho, tabulated.density(T[i], P[j], WATER_LIQUID),
+                        1.0E-10 * rho);
+            EXPECT_NEAR(exact.enthalpy(), tabulated.enthalpy(),
+                        1.0E-8 * fabs(exact.enthalpy()));
+            if (P[j] < exact.psat(T[i])) {
+                rho = exact.density(T[i], P[j], WATER_GAS);
+                EXPECT_NEAR(rho, tabulated.density(T[i], P[j], WATER_GAS),
+                            1.0E-7 * rho);
+            }
+        }
+    }
+}
+
+TEST_F(WaterPropsIAPWSTableTest, SaturationPressure)
+{
+    for (double T = 300.0; T < 560.0; T += 13.7) {
+        double p = exact.psat(T, WATER_GAS);
+        double rhoGas = exact.density();
+        EXPECT_NEAR(p, tabulated.psat(T, WATER_GAS), 1.0E-7 * p);
+        // psat() leaves the state at the densities found before its last
+        // pressure update, so these agree less closely than the pressures
+        EXPECT_NEAR(rhoGas, tabulated.density(), 1.0E-5 * rhoGas);
+    }
+}
+
+} // namespace Cantera
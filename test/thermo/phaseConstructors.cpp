@@ -190,4 +190,20 @@ TEST_F(ConstructFromScratch, addUndefinedElements)
     ASSERT_FLOAT_EQ(0.5, p.massFraction("CO2"));
 }
 
+TEST_F(ConstructFromScratch, speciesIndex)
+{
+    p.addElement("H");
+    p.addElement("O");
+    p.setName("gas");
+    p.addSpecies(sH2O);
+    p.addSpecies(sH2);
+    p.addSpecies(sO2);
+    ASSERT_EQ((size_t) 1, p.speciesIndex("H2"));
+    ASSERT_EQ((size_t) 2, p.speciesIndex("gas:O2"));
+    ASSERT_EQ(npos, p.speciesIndex("other:O2"));
+    ASSERT_EQ(npos, p.speciesIndex("OH"));
+    p.addSpecies(sOH);
+    ASSERT_EQ((size_t) 3, p.speciesIndex("OH"));
+}
+
 } // namespace Cantera
@@ -0,0 +1,142 @@
+#include "gtest/gtest.h"
+#include "cantera/zeroD/ReactorBatch.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+class ReactorBatchTest : public testing::Test
+{
+public:
+    ReactorBatchTest() : gas("h2o2.xml"), ncells(40), batch("h2o2.xml") {
+        nsp = gas.nSpecies();
+        // Cells with a range of temperatures, so that some of them ignite
+        // during the time step and are much more expensive than the others
+        states.resize(ncells * (nsp + 2));
+        for (size_t i = 0; i < ncells; i++) {
+            gas.setState_TPX(800.0 + 15.0 * i, OneAtm, "H2:2, O2:1, AR:4");
+            double* y = &states[i * (nsp + 2)];
+            y[0] = gas.temperature();
+            y[1] = gas.pressure();
+            gas.getMassFractions(y + 2);
+        }
+    }
+
+    //! Integrate the state *y0* using a separate ReactorNet
+    vector_fp reference(const double* y0, double dt) {
+        gas.setState_TPY(y0[0], y0[1], y0 + 2);
+        IdealGasConstPressureReactor r;
+        r.insert(gas);
+        ReactorNet net;
+        net.addReactor(r);
+        net.setTolerances(1e-9, 1e-15);
+        net.advance(dt);
+        vector_fp y(nsp + 2);
+        y[0] = gas.temperature();
+        y[1] = gas.pressure();
+        gas.getMassFractions(&y[2]);
+        return y;
+    }
+
+protected:
+    IdealGasMix gas;
+    size_t nsp;
+    size_t ncells;
+    vector_fp states;
+    ReactorBatch batch;
+};
+
+TEST_F(ReactorBatchTest, compare_single_reactors)
+{
+    double dt = 1e-3;
+    vector_fp initial = states;
+    ASSERT_EQ(nsp, batch.nSpecies());
+    batch.advance(ncells, &states[0], dt);
+    for (size_t i = 0; i < ncells; i += 3) {
+        vector_fp yref = reference(&initial[i * (nsp + 2)], dt);
+        EXPECT_NEAR(yref[0], states[i * (nsp + 2)], 1e-5 * yref[0]);
+        EXPECT_DOUBLE_EQ(yref[1], states[i * (nsp + 2) + 1]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(yref[k+2], states[i * (nsp + 2) + k + 2], 1e-6);
+        }
+    }
+    // The hottest cells ignite
+    EXPECT_GT(states[(ncells - 1) * (nsp + 2)], 2000.0);
+    EXPECT_GT(batch.nEvals(ncells - 1), batch.nEvals(0));
+}
+
+TEST_F(ReactorBatchTest, multiple_threads)
+{
+    vector_fp states1 = states;
+    batch.advance(ncells, &states1[0], 2e-4);
+    batch.advance(ncells, &states1[0], 2e-4);
+
+    batch.setThreads(3);
+    batch.setChunkSize(2);
+    ASSERT_EQ(3, (int) batch.nThreads());
+    vector_fp states3 = states;
+    batch.advance(ncells, &states3[0], 2e-4);
+    batch.advance(ncells, &states3[0], 2e-4);
+
+    size_t total = 0;
+    for (size_t n = 0; n < batch.nThreads(); n++) {
+        total += batch.cellsPerThread()[n];
+    }
+    EXPECT_EQ(ncells, total);
+    for (size_t j = 0; j < states.size(); j++) {
+        EXPECT_NEAR(states1[j], states3[j], 1e-8 * std::abs(states1[j]) + 1e-14);
+    }
+}
+
+TEST_F(ReactorBatchTest, failed_cell)
+{
+    batch.setThreads(2);
+    vector_fp initial = states;
+    states[5 * (nsp + 2)] = -300.0; // invalid temperature
+    ASSERT_THROW(batch.advance(ncells, &states[0], 1e-4), CanteraError);
+    EXPECT_EQ(-300.0, states[5 * (nsp + 2)]);
+    // All of the other cells are integrated
+    size_t nchanged = 0;
+    for (size_t i = 0; i < ncells; i++) {
+        size_t k = i * (nsp + 2) + 2 + gas.speciesIndex("H2O");
+        if (states[k] != initial[k]) {
+            nchanged++;
+        }
+    }
+    EXPECT_EQ(ncells - 1, nchanged);
+}
+
+TEST_F(ReactorBatchTest, rosenbrock)
+{
+    double dt = 1e-3;
+    vector_fp initial = states;
+    batch.setIntegratorType("Rosenbrock");
+    batch.setTolerances(1e-7, 1e-14);
+    batch.setThreads(2);
+    batch.advance(ncells, &states[0], dt);
+    for (size_t i = 0; i < ncells; i += 3) {
+        vector_fp yref = reference(&initial[i * (nsp + 2)], dt);
+        EXPECT_NEAR(yref[0], states[i * (nsp + 2)], 1e-4 * yref[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(yref[k+2], states[i * (nsp + 2) + k + 2], 1e-5);
+        }
+    }
+}
+
+TEST_F(ReactorBatchTest, invalid_reactor_type)
+{
+    ASSERT_THROW(ReactorBatch("h2o2.xml", "", "Reservoir"), CanteraError);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from ReactorBatch_Test.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IdealGasReactor.h"
+#include "cantera/zeroD/Reservoir.h"
+#include "cantera/zeroD/flowControllers.h"
+#include "cantera/zeroD/Wall.h"
+#include "cantera/IdealGasMix.h"
+
+namespace Cantera
+{
+
+//! Evaluates a function with Func1::eval(), so that a flow device or wall
+//! using it evaluates the expression tree instead of its compiled form
+class TreeFunc1 : public Func1
+{
+public:
+    explicit TreeFunc1(Func1& f) : m_f(f) {}
+    virtual doublereal eval(doublereal t) const {
+        return m_f.eval(t);
+    }
+    Func1& m_f;
+};
+
+class CompiledFunctionTest : public testing::Test
+{
+public:
+    CompiledFunctionTest() :
+        gas1("h2o2.xml"), gas2("h2o2.xml"),
+        inlet1("h2o2.xml"), inlet2("h2o2.xml"),
+        env1("h2o2.xml"), env2("h2o2.xml"),
+        mdotScale(new TimesConstant1(*new Pow1(2.0), 1e6)),
+        // mdot = 0.01 * exp(-1e6 t^2)
+        mdot(*new Composite1(*new Exp1(-1.0), *mdotScale), 0.01),
+        // q = 1e5 * sin(2e4 t)^2
+        qScale(new Sin1(2e4)),
+        q(*new Composite1(*new Pow1(2.0), *qScale), 1e5),
+        // v = 1e-3 * cos(5e3 t) + 1e-4, evaluated periodically
+        v(*new PlusConstant1(*new TimesConstant1(*new Cos1(5e3), 1e-3), 1e-4),
+          2e-4),
+        mdotTree(mdot), qTree(q), vTree(v)
+    {
+        setup(gas1, inlet1, env1, r1, in1, out1, mfc1, w1, net1);
+        setup(gas2, inlet2, env2, r2, in2, out2, mfc2, w2, net2);
+        mfc1.setFunction(&mdot);
+        w1.setHeatFlux(&q);
+        w1.setVelocity(&v);
+        mfc2.setFunction(&mdotTree);
+        w2.setHeatFlux(&qTree);
+        w2.setVelocity(&vTree);
+    }
+
+    void setup(IdealGasMix& gas, IdealGasMix& inlet, IdealGasMix& env,
+               IdealGasReactor& r, Reservoir& in, Reservoir& out,
+               MassFlowController& mfc, Wall& w, ReactorNet& net) {
+        gas.setState_TPX(1000.0, OneAtm, "H2:2, O2:1, AR:5");
+        r.insert(gas);
+        inlet.setState_TPX(300.0, OneAtm, "H2:1, AR:1");
+        in.insert(inlet);
+        env.setState_TPX(300.0, OneAtm, "AR:1");
+        out.insert(env);
+        mfc.install(in, r);
+        w.install(r, out);
+        w.setArea(0.1);
+        net.addReactor(r);
+    }
+
+    //! Check that both networks are in the same state
+    void compare() {
+        EXPECT_DOUBLE_EQ(r2.temperature(), r1.temperature());
+        EXPECT_DOUBLE_EQ(r2.density(), r1.density());
+        EXPECT_DOUBLE_EQ(r2.volume(), r1.volume());
+        EXPECT_DOUBLE_EQ(r2.pressure(), r1.pressure());
+    }
+
+    IdealGasMix gas1, gas2, inlet1, inlet2, env1, env2;
+    Func1* mdotScale;
+    TimesConstant1 mdot;
+    Func1* qScale;
+    TimesConstant1 q;
+    Periodic1 v;
+    TreeFunc1 mdotTree, qTree, vTree;
+    IdealGasReactor r1, r2;
+    Reservoir in1, in2, out1, out2;
+    MassFlowController mfc1, mfc2;
+    Wall w1, w2;
+    ReactorNet net1, net2;
+};
+
+TEST_F(CompiledFunctionTest, compare_with_tree)
+{
+    net1.advance(1e-3);
+    net2.advance(1e-3);
+    compare();
+
+    // Constants changed after the functions are set are used by both
+    mdotScale->setC(4e6);
+    qScale->setC(1e4);
+    v.setC(3e-4);
+    net1.advance(2e-3);
+    net2.advance(2e-3);
+    compare();
+}
+
+#if HAS_SUNDIALS
+
+//! Counts the evaluations of the sensitivity equations
+class CountingReactorNet : public ReactorNet
+{
+public:
+    CountingReactorNet() : nSensEvals(0) {}
+    virtual void evalSensitivities(double t, double* y, double* ydot,
+                                   double** s, double** sdot) {
+        nSensEvals++;
+        ReactorNet::evalSensitivities(t, y, ydot, s, sdot);
+    }
+    int nSensEvals;
+};
+
+class SensitivityEquationsTest : public testing::Test
+{
+public:
+    SensitivityEquationsTest() : gas1("h2o2.xml"), gas2("h2o2.xml") {
+        setup(gas1, r1, net1);
+        setup(gas2, r2, net2);
+    }
+
+    void setup(IdealGasMix& gas, IdealGasReactor& r, CountingReactorNet& net) {
+        gas.setState_TPX(1000.0, OneAtm, "H2:2, O2:1, AR:5");
+        r.insert(gas);
+        net.addReactor(r);
+        r.addSensitivityReaction(2);
+        r.addSensitivityReaction(9);
+        net.setSensitivityTolerances(1e-7, 1e-8);
+    }
+
+    //! Compare the sensitivities of the two networks
+    void compare() {
+        for (size_t p = 0; p < 2; p++) {
+            for (size_t k = 0; k < net1.neq(); k++) {
+                double s1 = net1.sensitivity(k, p);
+                EXPECT_NEAR(s1, net2.sensitivity(k, p), 1e-3 * std::abs(s1) + 1e-5)
+                    << "k = " << k << ", p = " << p;
+            }
+        }
+    }
+
+    IdealGasMix gas1, gas2;
+    IdealGasReactor r1, r2;
+    CountingReactorNet net1, net2;
+};
+
+TEST_F(SensitivityEquationsTest, toggle_between_steps)
+{
+    net1.setSensitivityEquations(true);
+    net1.advance(1e-4);
+    net2.advance(1e-4);
+    EXPECT_GT(net1.nSensEvals, 0);
+    EXPECT_EQ(0, net2.nSensEvals);
+    compare();
+
+    // Changing the setting restarts the integration, which has to switch the
+    // function used by CVODES for the sensitivity equations
+    int n1 = net1.nSensEvals;
+    net1.setSensitivityEquations(false);
+    net2.setSensitivityEquations(true);
+    net1.advance(2e-4);
+    net2.advance(2e-4);
+    EXPECT_EQ(n1, net1.nSensEvals);
+    EXPECT_GT(net2.nSensEvals, 0);
+    compare();
+}
+
+#endif
+
+}